@@ -0,0 +1,827 @@
+#include <CompactHypergraph.hpp>
+#include <Components.hpp>
+#include <Generator.hpp>
+#include <Hypergraph.hpp>
+#include <JsonWriter.hpp>
+#include <Parsing.hpp>
+#include <Partition.hpp>
+#include <Partitioning.hpp>
+#include <SSet.hpp>
+#include <Sweep.hpp>
+#include <ThreadPool.hpp>
+#include <Topology.hpp>
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+struct Timing
+{
+    double min_seconds;
+    double mean_seconds;
+};
+
+//runs @param func @param repetitions times and measures the wall time
+//@param setup is called before every run and is not measured
+template<class Setup, class Func>
+auto measure(std::size_t repetitions,
+             Setup&& setup,
+             Func&& func)
+    -> Timing
+{
+    std::vector<double> seconds;
+    for(std::size_t i{0}; i < repetitions; ++i) {
+        setup();
+        auto begin = std::chrono::steady_clock::now();
+        func();
+        auto end = std::chrono::steady_clock::now();
+        seconds.push_back(std::chrono::duration<double>(end - begin).count());
+    }
+
+    return Timing{*std::min_element(std::begin(seconds), std::end(seconds)),
+                  std::accumulate(std::begin(seconds), std::end(seconds), 0.0) / seconds.size()};
+}
+
+auto writeTiming(part::JsonWriter& json,
+                 const Timing& timing,
+                 std::size_t repetitions)
+    -> void
+{
+    json.key("repetitions").value(repetitions);
+    json.key("min_seconds").value(timing.min_seconds);
+    json.key("mean_seconds").value(timing.mean_seconds);
+}
+
+//number of vertices whose heuristics are computed at once,
+//about the number of candidates and secondary set nodes of SSet::addNodes
+constexpr std::size_t heuristic_batch_size{16};
+
+//computes the exact heuristic of @param vertices in batches of heuristic_batch_size,
+//once vertex by vertex and once with the batched kernel of the graph
+template<class Graph>
+auto benchmarkHeuristics(part::JsonWriter& json,
+                         const std::string& layout,
+                         const Graph& graph,
+                         const std::vector<int64_t>& vertices,
+                         std::size_t repetitions)
+    -> void
+{
+    std::vector<std::vector<int64_t>> batches;
+    for(std::size_t i{0}; i < vertices.size(); i += heuristic_batch_size) {
+        batches.emplace_back(std::begin(vertices) + i,
+                             std::begin(vertices) + std::min(i + heuristic_batch_size, vertices.size()));
+    }
+
+    double per_node_sum{0};
+    auto per_node = measure(
+        repetitions,
+        [&] { per_node_sum = 0; },
+        [&] {
+            for(auto&& batch : batches) {
+                for(auto&& vtx : batch) {
+                    per_node_sum += graph.getNodeHeuristicExactly(vtx);
+                }
+            }
+        });
+
+    double batched_sum{0};
+    std::vector<double> heuristics;
+    auto batched = measure(
+        repetitions,
+        [&] { batched_sum = 0; },
+        [&] {
+            for(auto&& batch : batches) {
+                graph.getNodeHeuristicsExactly(batch, heuristics);
+                batched_sum = std::accumulate(std::begin(heuristics), std::end(heuristics), batched_sum);
+            }
+        });
+
+    if(per_node_sum != batched_sum) {
+        std::cout << "batched heuristics of the " << layout << " layout differ from the ones per node\n";
+        std::exit(-1);
+    }
+
+    for(auto&& [method, timing] : {std::pair{"per_node", per_node}, std::pair{"batched", batched}}) {
+        json.beginObject();
+        json.key("benchmark").value("heuristic");
+        json.key("layout").value(layout);
+        json.key("method").value(method);
+        json.key("batch_size").value(heuristic_batch_size);
+        writeTiming(json, timing, repetitions);
+        json.key("vertices_per_second").value(vertices.size() / timing.min_seconds);
+        json.endObject();
+    }
+}
+
+//one measured value of a regression check
+struct CheckedValue
+{
+    std::string name;
+    double measured;
+    double baseline;
+    double limit;
+};
+
+/**
+ * partitions the graph described in the baseline file @param path
+ * and compares runtime and quality against the values stored in it.
+ * the run fails if soed, k-1 or the hyperedge cut exceed the baseline by more than
+ * quality-tolerance, and with @param check_time also if the time exceeds it by more
+ * than time-tolerance. the time is only comparable on the machine the baseline was
+ * stored on, so it is only reported otherwise.
+ * with @param update the measured values are written back into the file instead.
+ * @return exit code of hype_bench
+ */
+auto runCheck(const std::string& path,
+              std::size_t repetitions,
+              bool check_time,
+              bool update)
+    -> int
+{
+    namespace po = boost::program_options;
+
+    po::options_description baseline{"baseline"};
+
+    // clang-format off
+    baseline.add_options()
+        ("vertices", po::value<std::size_t>()->required())
+        ("edges", po::value<std::size_t>()->required())
+        ("vertex-exponent", po::value<double>()->required())
+        ("edge-exponent", po::value<double>()->required())
+        ("max-edge-size", po::value<std::size_t>()->required())
+        ("seed", po::value<std::uint32_t>()->required())
+        ("layout", po::value<std::string>()->required())
+        ("partitions", po::value<std::size_t>()->required())
+        ("sset-size", po::value<std::size_t>()->required())
+        ("seconds", po::value<double>()->default_value(0))
+        ("soed", po::value<double>()->default_value(0))
+        ("k-minus-1", po::value<double>()->default_value(0))
+        ("hyperedge-cut", po::value<double>()->default_value(0))
+        ("time-tolerance", po::value<double>()->default_value(3))
+        ("quality-tolerance", po::value<double>()->default_value(0.02));
+    // clang-format on
+
+    std::ifstream file{path};
+    if(!file) {
+        std::cout << "file: " << path << " not found\n";
+        std::exit(-1);
+    }
+
+    po::variables_map vm{};
+    po::store(po::parse_config_file(file, baseline), vm);
+    po::notify(vm);
+
+    const part::GeneratorConfig config{vm["vertices"].as<std::size_t>(),
+                                       vm["edges"].as<std::size_t>(),
+                                       vm["vertex-exponent"].as<double>(),
+                                       vm["edge-exponent"].as<double>(),
+                                       vm["max-edge-size"].as<std::size_t>(),
+                                       vm["seed"].as<std::uint32_t>()};
+    const auto layout = vm["layout"].as<std::string>();
+    const auto k = vm["partitions"].as<std::size_t>();
+    const auto sset_size = vm["sset-size"].as<std::size_t>();
+    const auto time_tolerance = vm["time-tolerance"].as<double>();
+    const auto quality_tolerance = vm["quality-tolerance"].as<double>();
+
+    if(layout != "hashmap" && layout != "csr" && layout != "varint") {
+        std::cout << "unknown layout " << layout << " in " << path << "\n";
+        std::exit(-1);
+    }
+
+    part::Hypergraph::setSeed(config.seed);
+
+    std::optional<part::CompactHypergraph> compact;
+    if(layout != "hashmap") {
+        compact.emplace(part::generatePowerLawHypergraph(config),
+                        layout == "csr" ? part::AdjacencyEncoding::Plain : part::AdjacencyEncoding::DeltaVarint);
+    }
+
+    part::Hypergraph graph;
+    std::vector<part::Partition> parts;
+    auto timing = measure(
+        repetitions,
+        [&] {
+            if(!compact)
+                graph = part::generatePowerLawHypergraph(config);
+        },
+        [&] {
+            auto run = [&](auto&& graph) {
+                return part::partitionGraph(std::forward<decltype(graph)>(graph),
+                                            k,
+                                            sset_size,
+                                            2,
+                                            0,
+                                            part::NodeHeuristicMode::Cached,
+                                            part::NodeSelectionMode::NextBest);
+            };
+            if(compact)
+                parts = run(*compact);
+            else
+                parts = run(std::move(graph));
+        });
+
+    const auto number_of_edges = config.number_of_edges;
+    const std::vector<std::pair<std::string, double>> measured{
+        {"seconds", timing.min_seconds},
+        {"soed", part::getSumOfExteralDegrees(parts).get()},
+        {"k-minus-1", part::getKminus1Metric(parts, number_of_edges).get()},
+        {"hyperedge-cut", part::getHyperedgeCut(parts).get()}};
+
+    if(update) {
+        std::ofstream out{path};
+        out << "# baseline of hype_bench --check, regenerate with --update-baseline\n"
+            << "vertices = " << config.number_of_vertices << "\n"
+            << "edges = " << config.number_of_edges << "\n"
+            << "vertex-exponent = " << config.vertex_degree_exponent << "\n"
+            << "edge-exponent = " << config.edge_size_exponent << "\n"
+            << "max-edge-size = " << config.max_edge_size << "\n"
+            << "seed = " << config.seed << "\n"
+            << "layout = " << layout << "\n"
+            << "partitions = " << k << "\n"
+            << "sset-size = " << sset_size << "\n";
+        for(auto&& [name, value] : measured) {
+            out << name << " = " << value << "\n";
+        }
+        out << "time-tolerance = " << time_tolerance << "\n"
+            << "quality-tolerance = " << quality_tolerance << "\n";
+
+        std::cout << "baseline " << path << " updated\n";
+        return 0;
+    }
+
+    std::vector<CheckedValue> checked;
+    for(auto&& [name, value] : measured) {
+        auto expected = vm[name].as<double>();
+        auto limit = name == "seconds"
+            ? expected * time_tolerance
+            : expected * (1 + quality_tolerance);
+        checked.push_back(CheckedValue{name, value, expected, limit});
+    }
+
+    bool failed{false};
+    for(auto&& value : checked) {
+        if(value.name == "seconds" && !check_time) {
+            std::cout << "skipped\t"
+                      << value.name
+                      << ": "
+                      << value.measured
+                      << " (baseline "
+                      << value.baseline
+                      << ", compared with --check-time)\n";
+            continue;
+        }
+
+        //a baseline of 0 is not checked
+        auto ok = value.baseline == 0 || value.measured <= value.limit;
+        failed |= !ok;
+
+        std::cout << (ok ? "ok\t" : "FAILED\t")
+                  << value.name
+                  << ": "
+                  << value.measured
+                  << " (baseline "
+                  << value.baseline
+                  << ", limit "
+                  << value.limit
+                  << ")\n";
+    }
+
+    return failed ? 1 : 0;
+}
+
+//number of files the generated graph is split into by runDeterminismCheck
+constexpr std::size_t determinism_shards{8};
+
+//partition of every vertex, ordered by vertex
+auto assignmentOf(const std::vector<part::Partition>& parts)
+    -> std::vector<int64_t>
+{
+    std::vector<std::pair<int64_t, int64_t>> assigned;
+    for(auto&& part : parts) {
+        for(auto&& vtx : part.getNodes()) {
+            assigned.emplace_back(vtx, part.getId());
+        }
+    }
+    std::sort(std::begin(assigned), std::end(assigned));
+
+    std::vector<int64_t> assignment;
+    for(auto&& [vtx, id] : assigned) {
+        assignment.push_back(vtx);
+        assignment.push_back(id);
+    }
+    return assignment;
+}
+
+//what every parallel phase produced with one number of threads, in the order of the phases
+using PhaseResults = std::vector<std::pair<std::string, std::vector<int64_t>>>;
+
+//runs every phase which uses threads on the graph of @param config with @param threads threads
+auto runParallelPhases(const part::GeneratorConfig& config,
+                       const std::string& shard_directory,
+                       std::size_t threads)
+    -> PhaseResults
+{
+    PhaseResults results;
+    part::ThreadPool pool{threads};
+
+    //shards are parsed in parallel and merged in the order of their files
+    auto graph = part::parseFileIntoHypergraph(shard_directory, part::ParsingMode::EdgeList, threads);
+    std::vector<int64_t> vertices;
+    for(auto&& [vtx, edges] : graph.getVertices()) {
+        vertices.push_back(vtx);
+        vertices.push_back(edges.size());
+    }
+    results.emplace_back("parse", std::move(vertices));
+
+    const part::CompactHypergraph compact{graph, part::AdjacencyEncoding::Plain};
+
+    auto components = part::findComponents(compact, pool);
+    results.emplace_back("components",
+                         std::vector<int64_t>{std::begin(components.representative_of),
+                                              std::end(components.representative_of)});
+
+    const std::size_t k{8};
+    auto packing = part::packSmallComponents(compact, components, k, part::BalanceMode::Vertices);
+    auto parts = part::partitionGraph(compact,
+                                      k,
+                                      10,
+                                      2,
+                                      0,
+                                      part::NodeHeuristicMode::Cached,
+                                      part::NodeSelectionMode::TrulyRandom,
+                                      config.seed,
+                                      nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      part::BalanceMode::Vertices,
+                                      &packing);
+    results.emplace_back("partition", assignmentOf(parts));
+    results.emplace_back("metrics",
+                         std::vector<int64_t>{static_cast<int64_t>(part::getSumOfExteralDegrees(parts).get()),
+                                              static_cast<int64_t>(part::getKminus1Metric(parts, compact.numberOfEdges()).get()),
+                                              static_cast<int64_t>(part::getHyperedgeCut(parts).get())});
+
+    const part::SweepSettings sweep_settings{2,
+                                             0,
+                                             part::NodeHeuristicMode::Cached,
+                                             part::NodeSelectionMode::TrulyRandom,
+                                             part::BalanceMode::Vertices,
+                                             true};
+    auto runs = part::runConfigurations(compact,
+                                        part::makeRunConfigurations({k}, {5, 10}, {config.seed, config.seed + 1}),
+                                        sweep_settings,
+                                        pool);
+    part::PortfolioSpread spread;
+    auto best = part::selectBestRun(runs, part::PortfolioMetric::KMinus1, spread);
+    results.emplace_back("portfolio", assignmentOf(best.partitions));
+
+    const part::TopologySettings topology_settings{10,
+                                                   2,
+                                                   0,
+                                                   part::NodeHeuristicMode::Cached,
+                                                   part::NodeSelectionMode::TrulyRandom,
+                                                   part::BalanceMode::Vertices,
+                                                   part::AdjacencyEncoding::Plain,
+                                                   config.seed};
+    results.emplace_back("topology",
+                         assignmentOf(part::partitionTopology(graph, part::Topology{{2, 4}}, topology_settings, pool)));
+
+    return results;
+}
+
+/**
+ * splits the graph of @param config into shards and runs parsing, components, partitioning,
+ * metrics, a portfolio and a topology once per number of threads in @param thread_counts.
+ * @return exit code of hype_bench, which fails if any phase has another result
+ *         than with the first number of threads
+ */
+auto runDeterminismCheck(const part::GeneratorConfig& config,
+                         const std::vector<std::size_t>& thread_counts,
+                         const std::filesystem::path& work_dir)
+    -> int
+{
+    part::Hypergraph::setSeed(config.seed);
+
+    //one edgelist line per vertex, so the lines can be split anywhere
+    auto file_path = work_dir / ("hype_bench_" + std::to_string(config.seed) + ".determinism");
+    part::writeHypergraphFile(part::generatePowerLawHypergraph(config), file_path.string(), part::ParsingMode::EdgeList);
+
+    std::vector<std::string> lines;
+    {
+        std::ifstream file{file_path};
+        for(std::string line; std::getline(file, line);) {
+            lines.push_back(std::move(line));
+        }
+    }
+    std::filesystem::remove(file_path);
+
+    auto shard_directory = work_dir / ("hype_bench_" + std::to_string(config.seed) + "_shards");
+    std::filesystem::remove_all(shard_directory);
+    std::filesystem::create_directories(shard_directory);
+    const auto lines_per_shard = (lines.size() + determinism_shards - 1) / determinism_shards;
+    for(std::size_t shard{0}; shard < determinism_shards; ++shard) {
+        std::ofstream out{shard_directory / ("shard_" + std::to_string(shard))};
+        for(auto i = shard * lines_per_shard; i < std::min(lines.size(), (shard + 1) * lines_per_shard); ++i) {
+            out << lines[i] << "\n";
+        }
+    }
+
+    std::optional<PhaseResults> expected;
+    bool failed{false};
+    for(auto&& threads : thread_counts) {
+        auto results = runParallelPhases(config, shard_directory.string(), threads);
+        if(!expected) {
+            expected = std::move(results);
+            continue;
+        }
+
+        for(std::size_t i{0}; i < results.size(); ++i) {
+            auto ok = results[i].second == (*expected)[i].second;
+            failed |= !ok;
+
+            std::cout << (ok ? "ok\t" : "FAILED\t")
+                      << results[i].first
+                      << " with "
+                      << threads
+                      << " threads "
+                      << (ok ? "equals" : "differs from")
+                      << " the run with "
+                      << thread_counts.front()
+                      << "\n";
+        }
+    }
+
+    std::filesystem::remove_all(shard_directory);
+    return failed ? 1 : 0;
+}
+
+/**
+ * partitions the graph of @param config, with isolated vertices and vertices of weight 0 added,
+ * on the hashmap and csr layout balanced on every BalanceMode.
+ * vertices without load must still be assigned, to the last partition if all others are full.
+ * @return exit code of hype_bench, which fails if a run leaves a vertex unassigned
+ */
+auto runAssignmentCheck(const part::GeneratorConfig& config)
+    -> int
+{
+    part::Hypergraph::setSeed(config.seed);
+
+    //the hashmap layout consumes its graph, so it is built again for every run
+    auto make_graph = [&config] {
+        auto graph = part::generatePowerLawHypergraph(config);
+        int64_t next_id{0};
+        std::size_t counter{0};
+        for(auto&& [vtx, edges] : graph.getVertices()) {
+            next_id = std::max(next_id, vtx + 1);
+            if(counter++ % 10 == 0)
+                graph.setVertexWeight(vtx, 0);
+        }
+        for(std::size_t i{0}; i < 100; ++i, ++next_id) {
+            graph.addVertex(next_id);
+            graph.setVertexWeight(next_id, i % 2);
+        }
+        return graph;
+    };
+
+    const part::CompactHypergraph compact{make_graph(), part::AdjacencyEncoding::Plain};
+    const auto number_of_vertices = compact.numberOfVertices();
+    const std::size_t k{4};
+
+    bool failed{false};
+    for(auto balance_on : {part::BalanceMode::Vertices, part::BalanceMode::Weight, part::BalanceMode::Pins}) {
+        for(std::string layout : {"hashmap", "csr"}) {
+            auto run = [&](auto&& graph) {
+                return part::partitionGraph(std::forward<decltype(graph)>(graph),
+                                            k,
+                                            10,
+                                            2,
+                                            0,
+                                            part::NodeHeuristicMode::Cached,
+                                            part::NodeSelectionMode::NextBest,
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            balance_on);
+            };
+            auto parts = layout == "csr" ? run(compact) : run(make_graph());
+
+            std::size_t assigned{0};
+            for(auto&& part : parts) {
+                assigned += part.numberOfNodes();
+            }
+
+            auto ok = assigned == number_of_vertices;
+            failed |= !ok;
+
+            std::cout << (ok ? "ok\t" : "FAILED\t")
+                      << layout
+                      << " balanced on "
+                      << balance_on
+                      << ": "
+                      << assigned
+                      << " of "
+                      << number_of_vertices
+                      << " vertices assigned\n";
+        }
+    }
+
+    return failed ? 1 : 0;
+}
+
+} // namespace
+
+
+auto main(int argc, char const* argv[])
+    -> int
+{
+    namespace po = boost::program_options;
+
+    po::options_description description{"hype_bench - Benchmarks for HYPE on synthetic power law hypergraphs"};
+
+    // clang-format off
+    description.add_options()
+        ("help,h", "display this help message")
+
+        ("vertices",
+         po::value<std::size_t>()->default_value(100000),
+         "number of vertices of the generated hypergraph")
+
+        ("edges",
+         po::value<std::size_t>()->default_value(50000),
+         "number of hyperedges of the generated hypergraph")
+
+        ("vertex-exponent",
+         po::value<double>()->default_value(2.2),
+         "exponent of the power law of the vertex degrees")
+
+        ("edge-exponent",
+         po::value<double>()->default_value(2.5),
+         "exponent of the power law of the hyperedge sizes")
+
+        ("max-edge-size",
+         po::value<std::size_t>()->default_value(1000),
+         "maximum number of vertices of a hyperedge")
+
+        ("seed,x",
+         po::value<std::uint32_t>()->default_value(0),
+         "seed used to generate the graph and to initialize the partitioner")
+
+        ("partitions,p",
+         po::value<std::vector<std::size_t>>()->multitoken()->default_value({2, 32}, "2 32"),
+         "numbers of partitions to benchmark")
+
+        ("sset-size,s",
+         po::value<std::vector<std::size_t>>()->multitoken()->default_value({10}, "10"),
+         "sizes of the secondary set to benchmark")
+
+        ("repetitions",
+         po::value<std::size_t>()->default_value(3),
+         "how often every benchmark is repeated")
+
+        ("work-dir",
+         po::value<std::string>()->default_value(std::filesystem::temp_directory_path().string()),
+         "directory the generated input files are written to")
+
+        ("output,o",
+         po::value<std::string>(),
+         "write the json results into this file instead of stdout")
+
+        ("check",
+         po::value<std::string>(),
+         "instead of benchmarking, partition the graph described in this baseline file and fail if the quality regressed")
+
+        ("check-time",
+         po::bool_switch()->default_value(false),
+         "with --check, also fail if the runtime regressed, only meaningful on the machine the baseline was stored on")
+
+        ("update-baseline",
+         po::bool_switch()->default_value(false),
+         "with --check, store the measured values in the baseline file")
+
+        ("check-determinism",
+         po::value<std::vector<std::size_t>>()->multitoken(),
+         "instead of benchmarking, run every parallel phase on the generated graph with each of these numbers of threads and fail if a result differs")
+
+        ("check-assignment",
+         po::bool_switch()->default_value(false),
+         "instead of benchmarking, partition the generated graph with isolated and weightless vertices added, balanced on vertices, weight and pins, and fail if a vertex is not assigned");
+    // clang-format on
+
+    po::variables_map vm{};
+    po::store(po::command_line_parser(argc, argv).options(description).run(), vm);
+    po::notify(vm);
+
+    if(vm.count("help")) {
+        std::cout << description;
+        return 0;
+    }
+
+    if(vm.count("check")) {
+        return runCheck(vm["check"].as<std::string>(),
+                        std::max<std::size_t>(vm["repetitions"].as<std::size_t>(), 1),
+                        vm["check-time"].as<bool>(),
+                        vm["update-baseline"].as<bool>());
+    }
+
+    const part::GeneratorConfig config{vm["vertices"].as<std::size_t>(),
+                                       vm["edges"].as<std::size_t>(),
+                                       vm["vertex-exponent"].as<double>(),
+                                       vm["edge-exponent"].as<double>(),
+                                       vm["max-edge-size"].as<std::size_t>(),
+                                       vm["seed"].as<std::uint32_t>()};
+
+    if(vm.count("check-determinism")) {
+        return runDeterminismCheck(config,
+                                   vm["check-determinism"].as<std::vector<std::size_t>>(),
+                                   vm["work-dir"].as<std::string>());
+    }
+
+    if(vm["check-assignment"].as<bool>()) {
+        return runAssignmentCheck(config);
+    }
+
+    const auto partition_counts = vm["partitions"].as<std::vector<std::size_t>>();
+    const auto sset_sizes = vm["sset-size"].as<std::vector<std::size_t>>();
+    const auto repetitions = std::max<std::size_t>(vm["repetitions"].as<std::size_t>(), 1);
+    const auto work_dir = std::filesystem::path{vm["work-dir"].as<std::string>()};
+
+    std::optional<std::ofstream> output_file;
+    if(vm.count("output")) {
+        output_file.emplace(vm["output"].as<std::string>());
+    }
+    auto& out = output_file ? output_file.value() : std::cout;
+
+    part::Hypergraph::setSeed(config.seed);
+
+    part::JsonWriter json{out};
+    json.beginObject();
+
+    //generate the graph and write it in every input format
+    auto begin = std::chrono::steady_clock::now();
+    auto graph = part::generatePowerLawHypergraph(config);
+    auto generation_time =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    const auto pins = graph.numberOfPins();
+
+    json.key("graph").beginObject();
+    json.key("vertices").value(graph.getVertices().size());
+    json.key("edges").value(graph.getEdges().size());
+    json.key("pins").value(pins);
+    json.key("vertex_exponent").value(config.vertex_degree_exponent);
+    json.key("edge_exponent").value(config.edge_size_exponent);
+    json.key("max_edge_size").value(config.max_edge_size);
+    json.key("seed").value(config.seed);
+    json.key("generation_seconds").value(generation_time);
+    json.endObject();
+
+    const std::vector<std::pair<part::ParsingMode, std::string>> formats{
+        {part::ParsingMode::Hmetis, "hmetis"},
+        {part::ParsingMode::EdgeList, "hyperedgelist"},
+        {part::ParsingMode::Bipartite, "bipartite"}};
+
+    std::vector<std::string> files;
+    for(auto&& [mode, name] : formats) {
+        auto path = work_dir / ("hype_bench_" + std::to_string(config.seed) + "." + name);
+        part::writeHypergraphFile(graph, path.string(), mode);
+        files.push_back(path.string());
+    }
+    const auto& hmetis_file = files.front();
+    graph = part::Hypergraph{};
+
+    json.key("results").beginArray();
+
+    //parsing in every format
+    for(std::size_t i{0}; i < formats.size(); ++i) {
+        auto timing = measure(
+            repetitions,
+            [] {},
+            [&] { part::parseFileIntoHypergraph(files[i], formats[i].first); });
+
+        json.beginObject();
+        json.key("benchmark").value("parse");
+        json.key("format").value(formats[i].second);
+        writeTiming(json, timing, repetitions);
+        json.key("pins_per_second").value(pins / timing.min_seconds);
+        json.endObject();
+    }
+
+    //partitioning for every layout, heuristic, sset size and number of partitions
+    auto parsed = part::parseFileIntoHypergraph(hmetis_file, part::ParsingMode::Hmetis);
+    const auto number_of_edges = parsed.getEdges().size();
+    part::CompactHypergraph csr{parsed, part::AdjacencyEncoding::Plain};
+    part::CompactHypergraph varint{parsed, part::AdjacencyEncoding::DeltaVarint};
+
+    const std::vector<std::string> layouts{"hashmap", "csr", "varint"};
+
+    //heuristics of every vertex in random batches, like the candidates found by neighbourhood expansion
+    {
+        std::vector<int64_t> dense_ids(csr.numberOfVertices());
+        std::iota(std::begin(dense_ids), std::end(dense_ids), 0);
+        std::shuffle(std::begin(dense_ids), std::end(dense_ids), std::mt19937{config.seed});
+
+        std::vector<int64_t> ids;
+        for(auto&& vtx : dense_ids) {
+            ids.push_back(csr.originalVertexId(vtx));
+        }
+
+        benchmarkHeuristics(json, "hashmap", parsed, ids, repetitions);
+        benchmarkHeuristics(json, "csr", part::ResidualHypergraph{csr, config.seed}, dense_ids, repetitions);
+        benchmarkHeuristics(json, "varint", part::ResidualHypergraph{varint, config.seed}, dense_ids, repetitions);
+    }
+    parsed = part::Hypergraph{};
+    const std::vector<part::NodeHeuristicMode> heuristics{part::NodeHeuristicMode::Cached,
+                                                          part::NodeHeuristicMode::Exact};
+    std::vector<part::Partition> metric_parts;
+
+    for(auto&& layout : layouts) {
+        for(auto&& heuristic : heuristics) {
+            for(auto&& sset_size : sset_sizes) {
+                for(auto&& k : partition_counts) {
+                    part::Hypergraph graph_copy;
+                    std::vector<part::Partition> parts;
+
+                    auto timing = measure(
+                        repetitions,
+                        [&] {
+                            if(layout == "hashmap")
+                                graph_copy = part::parseFileIntoHypergraph(hmetis_file, part::ParsingMode::Hmetis);
+                        },
+                        [&] {
+                            auto run = [&](auto&& graph) {
+                                return part::partitionGraph(std::forward<decltype(graph)>(graph),
+                                                            k,
+                                                            sset_size,
+                                                            2,
+                                                            0,
+                                                            heuristic,
+                                                            part::NodeSelectionMode::NextBest);
+                            };
+                            if(layout == "hashmap")
+                                parts = run(std::move(graph_copy));
+                            else if(layout == "csr")
+                                parts = run(csr);
+                            else
+                                parts = run(varint);
+                        });
+
+                    json.beginObject();
+                    json.key("benchmark").value("partition");
+                    json.key("layout").value(layout);
+                    json.key("heuristic").value(heuristic == part::NodeHeuristicMode::Exact ? "exact" : "cached");
+                    json.key("sset_size").value(sset_size);
+                    json.key("partitions").value(k);
+                    writeTiming(json, timing, repetitions);
+                    json.key("vertices_per_second").value(csr.numberOfVertices() / timing.min_seconds);
+                    json.key("soed").value(part::getSumOfExteralDegrees(parts).get());
+                    json.key("k_minus_1").value(part::getKminus1Metric(parts, number_of_edges).get());
+                    json.key("hyperedge_cut").value(part::getHyperedgeCut(parts).get());
+                    json.endObject();
+
+                    if(metric_parts.empty())
+                        metric_parts = std::move(parts);
+                }
+            }
+        }
+    }
+
+    //every metric on the first partitioning
+    const std::vector<std::pair<std::string, std::function<void()>>> metrics{
+        {"soed", [&] { part::getSumOfExteralDegrees(metric_parts).get(); }},
+        {"hyperedge_cut", [&] { part::getHyperedgeCut(metric_parts).get(); }},
+        {"k_minus_1", [&] { part::getKminus1Metric(metric_parts, number_of_edges).get(); }},
+        {"vertex_balancing", [&] { part::getVertexBalancing(metric_parts).get(); }},
+        {"edge_balancing", [&] { part::getEdgeBalancing(metric_parts).get(); }}};
+
+    for(auto&& [name, metric] : metrics) {
+        auto timing = measure(repetitions, [] {}, metric);
+
+        json.beginObject();
+        json.key("benchmark").value("metric");
+        json.key("metric").value(name);
+        json.key("partitions").value(metric_parts.size());
+        writeTiming(json, timing, repetitions);
+        json.endObject();
+    }
+
+    json.endArray();
+    json.endObject();
+    out << std::endl;
+
+    for(auto&& file : files) {
+        std::remove(file.c_str());
+    }
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+namespace part {
+
+enum class AdjacencyEncoding {
+    Plain,      // 32bit ids, one after another
+    DeltaVarint // sorted ids, stored as LEB128 varints of their differences
+};
+
+//needed to be able to parse commandline arguments
+//into the AdjacencyEncoding enum
+auto operator>>(std::istream& in, part::AdjacencyEncoding& encoding)
+    -> std::istream&;
+auto operator<<(std::ostream& os, const part::AdjacencyEncoding& encoding)
+    -> std::ostream&;
+
+//appends @param value as LEB128 varint to @param out
+auto encodeVarint(std::uint64_t value,
+                  std::vector<std::uint8_t>& out)
+    -> void;
+
+//appends the sorted list @param ids to @param out in the given encoding
+auto encodeList(AdjacencyEncoding encoding,
+                const std::vector<std::uint64_t>& ids,
+                std::vector<std::uint8_t>& out)
+    -> void;
+
+//decodes a LEB128 varint starting at @param data
+//and advances @param data behind it
+inline auto decodeVarint(const std::uint8_t*& data)
+    -> std::uint64_t
+{
+    std::uint64_t value{0};
+    unsigned shift{0};
+    while(*data & 0x80) {
+        value |= static_cast<std::uint64_t>(*data++ & 0x7f) << shift;
+        shift += 7;
+    }
+    return value | static_cast<std::uint64_t>(*data++) << shift;
+}
+
+//immutable list of lists of dense ids, in the style of a CSR matrix
+//every list is stored sorted, either plain or delta-varint encoded
+//the lists are decoded on the fly while iterating over them
+class Adjacency
+{
+public:
+    //make adjacencies move only
+    Adjacency() = default;
+    Adjacency(Adjacency&&) = default;
+    Adjacency(const Adjacency&) = delete;
+    auto operator=(Adjacency &&)
+        -> Adjacency& = default;
+    auto operator=(const Adjacency&)
+        -> Adjacency& = delete;
+
+    explicit Adjacency(AdjacencyEncoding encoding);
+
+    //adjacency of @param size lists on memory owned by someone else,
+    //e.g. a memory mapped file or the arrays of a caller of the library
+    //@param offsets count units of @param offset_unit bytes,
+    //e.g. 4 for the offsets of a plain csr array of 32bit ids
+    Adjacency(AdjacencyEncoding encoding,
+              std::size_t size,
+              const std::uint64_t* offsets,
+              const std::uint8_t* data,
+              std::size_t offset_unit = 1);
+
+    //appends a new list, the ids get sorted before they are encoded
+    //only possible for adjacencies owning their lists
+    auto addList(std::vector<std::uint64_t> ids)
+        -> void;
+
+    //number of lists
+    auto size() const
+        -> std::size_t;
+
+    //number of ids in the given list
+    auto sizeOf(std::size_t list) const
+        -> std::size_t;
+
+    //bytes used by the encoded lists and the offsets
+    //lists not owned by the adjacency are not counted
+    auto memoryUsage() const
+        -> std::size_t;
+
+    auto getEncoding() const
+        -> AdjacencyEncoding;
+
+    //hints the cpu to load the start of @param list into the cache,
+    //for loops which know the lists they read a while before reading them
+    auto prefetch(std::size_t list) const
+        -> void;
+
+    //calls @param func for every id of @param list in ascending order
+    //if @param func returns a bool, iterating stops as soon as it returns false
+    template<class Func>
+    auto forEach(std::size_t list, Func&& func) const
+        -> void;
+
+private:
+    AdjacencyEncoding _encoding{AdjacencyEncoding::Plain};
+    std::size_t _size{0};
+    const std::uint64_t* _offsets{nullptr}; //byte offset of every list into _data
+    const std::uint8_t* _data{nullptr};     //encoded lists
+    std::size_t _offset_unit{1};            //bytes per unit of _offsets
+
+    //storage of lists added with addList
+    std::vector<std::uint64_t> _owned_offsets{0};
+    std::vector<std::uint8_t> _owned_data;
+};
+
+
+template<class Func>
+auto Adjacency::forEach(std::size_t list, Func&& func) const
+    -> void
+{
+    constexpr auto can_stop = std::is_same_v<std::invoke_result_t<Func, std::uint64_t>, bool>;
+
+    const auto* begin = _data + _offsets[list] * _offset_unit;
+    const auto* end = _data + _offsets[list + 1] * _offset_unit;
+
+    if(_encoding == AdjacencyEncoding::Plain) {
+        for(; begin != end; begin += sizeof(std::uint32_t)) {
+            std::uint32_t id;
+            std::memcpy(&id, begin, sizeof(id));
+
+            if constexpr(can_stop) {
+                if(!func(static_cast<std::uint64_t>(id)))
+                    return;
+            } else {
+                func(static_cast<std::uint64_t>(id));
+            }
+        }
+        return;
+    }
+
+    //the first varint holds the length of the list
+    auto length = decodeVarint(begin);
+    std::uint64_t id{0};
+    for(std::uint64_t i{0}; i < length; ++i) {
+        id += decodeVarint(begin);
+
+        if constexpr(can_stop) {
+            if(!func(id))
+                return;
+        } else {
+            func(id);
+        }
+    }
+}
+
+} // namespace part
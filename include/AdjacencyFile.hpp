@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Adjacency.hpp>
+#include <CompactHypergraph.hpp>
+#include <Parsing.hpp>
+#include <optional>
+#include <string>
+
+namespace part {
+
+/**
+ * parses the hypergraph file at @param input_path and writes its compact
+ * adjacency into @param file_path without building the graph in memory.
+ * the pins are streamed through temporary files next to @param file_path,
+ * only the id maps and per vertex/edge counters are kept in memory.
+ * the file remembers the input it was built from, see AdjacencyFileSource.
+ */
+auto buildAdjacencyFile(const std::string& input_path,
+                        ParsingMode mode,
+                        const std::string& file_path,
+                        AdjacencyEncoding encoding)
+    -> void;
+
+//what an adjacency file was built from
+struct AdjacencyFileSource
+{
+    std::uint64_t input_fingerprint{0}; //see inputFingerprint
+    ParsingMode format{ParsingMode::EdgeList};
+    AdjacencyEncoding encoding{AdjacencyEncoding::Plain};
+};
+
+//reads the source from the header of @param file_path,
+//nullopt if it is no adjacency file of the current version
+auto readAdjacencyFileSource(const std::string& file_path)
+    -> std::optional<AdjacencyFileSource>;
+
+/**
+ * memory maps an adjacency file written by buildAdjacencyFile.
+ * the adjacency and the id maps stay on disk and are paged in on demand,
+ * so the graph can be bigger than the main memory.
+ */
+auto mapAdjacencyFile(const std::string& file_path)
+    -> CompactHypergraph;
+
+} // namespace part
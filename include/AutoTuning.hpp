@@ -0,0 +1,79 @@
+#pragma once
+
+#include <CompactHypergraph.hpp>
+#include <SSet.hpp>
+#include <ThreadPool.hpp>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace part {
+
+//distribution of the vertex degrees and edge sizes of a graph
+struct GraphStatistics
+{
+    std::size_t vertices{0};
+    std::size_t edges{0};
+    std::size_t pins{0};
+
+    double mean_degree{0};
+    std::size_t median_degree{0};
+    std::size_t max_degree{0};
+
+    double mean_edge_size{0};
+    std::size_t median_edge_size{0};
+    std::size_t p99_edge_size{0};
+    std::size_t max_edge_size{0};
+};
+
+//computes the statistics in parallel over ranges of vertices and edges
+auto computeGraphStatistics(const CompactHypergraph& graph,
+                            ThreadPool& pool)
+    -> GraphStatistics;
+
+auto operator<<(std::ostream& os, const GraphStatistics& statistics)
+    -> std::ostream&;
+
+//what is fixed while the parameters are tuned
+struct AutoTuneSettings
+{
+    std::size_t number_of_partitions;
+    //the full partitioning should not take longer
+    std::chrono::duration<double> time_budget;
+    NodeHeuristicMode num_neigs_flag;
+    NodeSelectionMode node_select_flag;
+    BalanceMode balance_on;
+    std::uint32_t seed;
+};
+
+//the parameters chosen by tuneParameters and what they achieved on the sample
+struct TunedParameters
+{
+    std::size_t s_set_size;
+    std::size_t s_set_candidates;
+    double ignore_biggest_edges_in_percent;
+
+    double sample_fraction;       //of the edges of the graph
+    std::size_t sample_k_minus_1; //of the trial with these parameters
+    double predicted_seconds;     //for the whole graph
+    std::size_t trials;
+};
+
+/**
+ * partitions a sample of @param graph with every combination of a few secondary set sizes,
+ * numbers of expansion candidates and, if the edge sizes have a long tail, percents of ignored edges,
+ * all trials in parallel on @param pool.
+ * the sample holds a random part of the edges with all their vertices, at most about a million pins.
+ * the time of a trial is scaled up by the pins of the graph divided by the pins of the sample.
+ * @return the parameters with the smallest K-1 on the sample whose predicted time fits into the budget,
+ *         the fastest ones if none fits. ties in K-1 are won by the trial tried first,
+ *         so only whether a trial fits depends on the measured times
+ */
+auto tuneParameters(const CompactHypergraph& graph,
+                    const GraphStatistics& statistics,
+                    const AutoTuneSettings& settings,
+                    ThreadPool& pool)
+    -> TunedParameters;
+
+} // namespace part
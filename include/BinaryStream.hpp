@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+//values in native byte order, for files which are only read back
+//by the same build, like checkpoints
+//reading past the end sets the failbit of the stream, callers check it once at the end,
+//so does a stored length which is longer than the rest of the stream
+
+namespace part {
+
+//bytes between the read position of @param in and its end,
+//the maximum for streams which can not seek
+inline auto remainingBytes(std::istream& in)
+    -> std::uint64_t
+{
+    const auto position = in.tellg();
+    if(position < 0)
+        return std::numeric_limits<std::uint64_t>::max();
+
+    in.seekg(0, std::ios::end);
+    const auto end = in.tellg();
+    in.seekg(position);
+    return end < position ? 0 : static_cast<std::uint64_t>(end - position);
+}
+
+template<class T>
+auto writeValue(std::ostream& out, const T& value)
+    -> void
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<class T>
+auto readValue(std::istream& in)
+    -> T
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    T value{};
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+
+template<class T>
+auto writeValues(std::ostream& out, const std::vector<T>& values)
+    -> void
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    writeValue<std::uint64_t>(out, values.size());
+    out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+template<class T>
+auto readValues(std::istream& in)
+    -> std::vector<T>
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    auto size = readValue<std::uint64_t>(in);
+    if(!in)
+        return {};
+    if(size > remainingBytes(in) / sizeof(T)) {
+        in.setstate(std::ios_base::failbit);
+        return {};
+    }
+
+    std::vector<T> values(size);
+    in.read(reinterpret_cast<char*>(values.data()), size * sizeof(T));
+    return values;
+}
+
+template<class Key, class Value>
+auto writeValues(std::ostream& out, const std::unordered_map<Key, Value>& values)
+    -> void
+{
+    writeValue<std::uint64_t>(out, values.size());
+    for(auto&& [key, value] : values) {
+        writeValue(out, key);
+        writeValue(out, value);
+    }
+}
+
+template<class Key, class Value>
+auto readValues(std::istream& in, std::unordered_map<Key, Value>& values)
+    -> void
+{
+    auto size = readValue<std::uint64_t>(in);
+    if(in && size > remainingBytes(in) / (sizeof(Key) + sizeof(Value))) {
+        in.setstate(std::ios_base::failbit);
+        return;
+    }
+
+    values.reserve(size);
+    for(std::uint64_t i{0}; i < size && in; ++i) {
+        auto key = readValue<Key>(in);
+        values[key] = readValue<Value>(in);
+    }
+}
+
+//values without a fixed layout, like random engines, in their text form
+template<class T>
+auto writeFormatted(std::ostream& out, const T& value)
+    -> void
+{
+    std::ostringstream text;
+    text << value;
+    auto str = text.str();
+    writeValues(out, std::vector<char>{std::begin(str), std::end(str)});
+}
+
+template<class T>
+auto readFormatted(std::istream& in, T& value)
+    -> void
+{
+    auto chars = readValues<char>(in);
+    std::istringstream text{std::string{std::begin(chars), std::end(chars)}};
+    if(!(text >> value))
+        in.setstate(std::ios_base::failbit);
+}
+
+} // namespace part
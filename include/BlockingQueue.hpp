@@ -0,0 +1,64 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace part {
+
+//queue with a maximum number of elements to pass work between threads
+//push blocks while the queue is full, pop blocks while it is empty
+template<class T>
+class BlockingQueue
+{
+public:
+    explicit BlockingQueue(std::size_t capacity)
+        : _capacity(capacity) {}
+
+    //adds @param elem to the queue, waits until there is space for it
+    auto push(T elem)
+        -> void
+    {
+        std::unique_lock lock{_mutex};
+        _not_full.wait(lock, [this] { return _queue.size() < _capacity; });
+        _queue.push_back(std::move(elem));
+        _not_empty.notify_one();
+    }
+
+    //returns the next element or an empty optional
+    //if the queue is closed and all elements were popped
+    auto pop()
+        -> std::optional<T>
+    {
+        std::unique_lock lock{_mutex};
+        _not_empty.wait(lock, [this] { return !_queue.empty() || _closed; });
+        if(_queue.empty()) {
+            return std::nullopt;
+        }
+
+        auto elem = std::move(_queue.front());
+        _queue.pop_front();
+        _not_full.notify_one();
+        return elem;
+    }
+
+    //no elements will be pushed anymore
+    auto close()
+        -> void
+    {
+        std::lock_guard lock{_mutex};
+        _closed = true;
+        _not_empty.notify_all();
+    }
+
+private:
+    std::size_t _capacity;
+    bool _closed{false};
+    std::deque<T> _queue;
+    std::mutex _mutex;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+};
+
+} // namespace part
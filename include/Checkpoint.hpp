@@ -0,0 +1,86 @@
+#pragma once
+
+#include <Parsing.hpp>
+#include <Reordering.hpp>
+#include <SSet.hpp>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace part {
+
+//how the graph given to partitionGraph was built, only known to the caller.
+//the stored vertex ids are only valid for a graph built the same way
+struct GraphOrigin
+{
+    std::uint64_t input_fingerprint{0}; //see inputFingerprint
+    ParsingMode format{ParsingMode::EdgeList};
+    std::string layout;                 //like hashmap, csr, varint or adjacency file
+    VertexOrder vertex_order{VertexOrder::Input};
+    double pruned_percent{0};
+};
+
+auto operator==(const GraphOrigin& lhs, const GraphOrigin& rhs)
+    -> bool;
+
+//periodic checkpoints of partitionGraph, so that a preempted run can be resumed
+struct CheckpointSettings
+{
+    std::string path;
+    std::chrono::duration<double> interval{600};
+    //continue from the checkpoint at path if there is one
+    bool resume{false};
+    GraphOrigin origin;
+};
+
+//parameters of the run which wrote a checkpoint,
+//a checkpoint is only resumed by a run with the same ones
+struct CheckpointParameters
+{
+    std::uint64_t number_of_vertices{0};
+    std::uint64_t number_of_partitions{0};
+    std::uint64_t s_set_size{0};
+    std::uint64_t s_set_candidates{0};
+    double ignore_biggest_edges_in_percent{0};
+    NodeHeuristicMode num_neigs_flag{NodeHeuristicMode::Cached};
+    NodeSelectionMode node_select_flag{NodeSelectionMode::NextBest};
+    BalanceMode balance_on{BalanceMode::Vertices};
+    GraphOrigin origin;
+};
+
+auto operator==(const CheckpointParameters& lhs, const CheckpointParameters& rhs)
+    -> bool;
+
+/**
+ * state of partitionGraph between two assigned vertices.
+ * the partitions are stored as the vertices in the order they were assigned,
+ * resuming assigns and deletes them again on the freshly parsed graph,
+ * which leaves the graph in the same state as in the interrupted run.
+ * in the file, the state of the graph and the secondary set follow,
+ * see Hypergraph::writeState and SSet::writeState
+ */
+struct PartitioningCheckpoint
+{
+    CheckpointParameters parameters;
+    std::uint64_t max_edge_size{0};
+    std::uint64_t sset_hits{0};
+    std::uint64_t seed_fallbacks{0};
+    std::uint64_t sset_candidates{0};
+    //number of vertices of every partition up to the current one, which is the last
+    std::vector<std::uint64_t> partition_sizes;
+    std::vector<int64_t> assigned_vertices;
+};
+
+auto writeCheckpoint(std::ostream& out,
+                     const PartitioningCheckpoint& checkpoint)
+    -> void;
+
+//exits if the stream does not hold a checkpoint written by writeCheckpoint,
+//or if it is corrupt
+auto readCheckpoint(std::istream& in,
+                    const std::string& path)
+    -> PartitioningCheckpoint;
+
+} // namespace part
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <Adjacency.hpp>
+#include <Hypergraph.hpp>
+#include <MappedFile.hpp>
+#include <Reordering.hpp>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace part {
+
+//read only hypergraph with dense vertex and edge ids
+//both directions of the adjacency are stored as sorted lists
+//which can be compressed, see Adjacency
+//the original ids of the parsed graph are kept to translate results back
+class CompactHypergraph
+{
+public:
+    //make compact hypergraphs move only
+    CompactHypergraph(CompactHypergraph&&) = default;
+    CompactHypergraph(const CompactHypergraph&) = delete;
+    auto operator=(CompactHypergraph &&)
+        -> CompactHypergraph& = default;
+    auto operator=(const CompactHypergraph&)
+        -> CompactHypergraph& = delete;
+
+    //builds the compact representation of @param graph
+    //vertices are numbered in the given order, see computeVertexOrder,
+    //edges in the order they are reached from the vertices,
+    //with VertexOrder::Input both in the iteration order of the graph
+    CompactHypergraph(const Hypergraph& graph,
+                      AdjacencyEncoding encoding,
+                      VertexOrder order = VertexOrder::Input);
+
+    //compact hypergraph whose adjacency and ids live in @param file
+    //see mapAdjacencyFile
+    //without @param vertex_ids and @param edge_ids, the original ids are the dense ids,
+    //without @param vertex_weights every vertex weighs 1
+    CompactHypergraph(Adjacency vertex_edges,
+                      Adjacency edge_vertices,
+                      const int64_t* vertex_ids,
+                      const int64_t* edge_ids,
+                      std::shared_ptr<const MappedFile> file,
+                      const std::uint64_t* vertex_weights = nullptr);
+
+    auto numberOfVertices() const
+        -> std::size_t;
+
+    auto numberOfEdges() const
+        -> std::size_t;
+
+    //number of edges the given vertex is connected to
+    auto degreeOf(std::uint64_t vtx) const
+        -> std::size_t;
+
+    //number of vertices connected to the given edge
+    auto sizeOf(std::uint64_t edge) const
+        -> std::size_t;
+
+    //weight of the given vertex, 1 if the graph has no vertex weights
+    auto weightOf(std::uint64_t vtx) const
+        -> std::uint64_t;
+
+    //see Adjacency::prefetch
+    auto prefetchEdgesOf(std::uint64_t vtx) const
+        -> void;
+
+    //calls @param func for every edge of @param vtx, see Adjacency::forEach
+    template<class Func>
+    auto forEachEdgeOf(std::uint64_t vtx, Func&& func) const
+        -> void;
+
+    //calls @param func for every vertex of @param edge, see Adjacency::forEach
+    template<class Func>
+    auto forEachVertexOf(std::uint64_t edge, Func&& func) const
+        -> void;
+
+    //ids of the vertex/edge in the graph this graph was build from
+    auto originalVertexId(std::uint64_t vtx) const
+        -> int64_t;
+    auto originalEdgeId(std::uint64_t edge) const
+        -> int64_t;
+
+    //bytes used by both adjacencies and the id maps
+    //memory mapped parts are not counted
+    auto memoryUsage() const
+        -> std::size_t;
+
+    auto getEncoding() const
+        -> AdjacencyEncoding;
+
+private:
+    Adjacency _vertex_edges;  //edges of every vertex
+    Adjacency _edge_vertices; //vertices of every edge
+    std::size_t _number_of_vertices;
+    std::size_t _number_of_edges;
+    const int64_t* _vertex_ids; //original id of every vertex, nullptr if the ids are dense
+    const int64_t* _edge_ids;   //original id of every edge, nullptr if the ids are dense
+
+    //weight of every vertex, nullptr if the graph has no vertex weights
+    const std::uint64_t* _vertex_weights{nullptr};
+
+    //storage of the ids and weights if the graph is not memory mapped
+    std::vector<int64_t> _owned_vertex_ids;
+    std::vector<int64_t> _owned_edge_ids;
+    std::vector<std::uint64_t> _owned_vertex_weights;
+
+    std::shared_ptr<const MappedFile> _file;
+};
+
+//the part of a CompactHypergraph which is not yet partitioned
+//deleting a vertex only marks it as deleted and shrinks its edges,
+//the adjacency itself is never touched, so it can stay compressed
+//implements the same interface as Hypergraph for partitioning
+class ResidualHypergraph
+{
+public:
+    ResidualHypergraph(const CompactHypergraph& graph,
+                       uint32_t seed);
+
+    //number of vertices which are not deleted yet
+    auto numberOfVertices() const
+        -> std::size_t;
+
+    //see Hypergraph, only not deleted vertices count
+    auto numberOfPins() const
+        -> std::size_t;
+
+    auto getVertexWeight(const int64_t& vtx) const
+        -> std::uint64_t;
+
+    auto totalVertexWeight() const
+        -> std::uint64_t;
+
+    //see Hypergraph
+    auto getEdgesizeOfPercentBiggestEdge(double percent) const
+        -> std::size_t;
+
+    auto deleteVertex(int64_t vtx)
+        -> void;
+
+    auto getEdgesOf(const int64_t& vtx) const
+        -> std::vector<int64_t>;
+
+    auto getSSetCandidates(const int64_t& vtx,
+                           std::size_t n,
+                           std::size_t max_edge_size) const
+        -> std::unordered_set<int64_t>;
+
+    auto getNodeHeuristicExactly(const int64_t& vtx) const
+        -> double;
+
+    auto getNodeHeuristicEstimate(const int64_t& vtx) const
+        -> double;
+
+    //see Hypergraph, the edge lists of the whole batch are prefetched first,
+    //then the sizes of all their edges, and the sizes are summed last,
+    //so the cache misses of the batch overlap instead of waiting for each other
+    auto getNodeHeuristicsExactly(const std::vector<int64_t>& vertices,
+                                  std::vector<double>& heuristics) const
+        -> void;
+    auto getNodeHeuristicsEstimate(const std::vector<int64_t>& vertices,
+                                   std::vector<double>& heuristics) const
+        -> void;
+
+    auto getRandomNode() const
+        -> int64_t;
+
+    //returns the not deleted node with the smallest id
+    auto getANode() const
+        -> int64_t;
+
+    //see Hypergraph, deleted vertices are not part of the state,
+    //they are deleted again when a checkpoint is resumed
+    auto writeState(std::ostream& out) const
+        -> void;
+    auto readState(std::istream& in)
+        -> void;
+
+private:
+    const CompactHypergraph& _graph;
+    std::vector<bool> _deleted;
+    std::vector<std::uint32_t> _edge_sizes; //number of not deleted vertices per edge
+    std::size_t _remaining;
+    mutable std::size_t _first_remaining{0};
+    mutable std::unordered_map<int64_t, double> _neigbour_map;
+    mutable std::mt19937 _engine;
+
+    //reused by getNodeHeuristicsExactly, so batches do not allocate
+    mutable std::vector<std::uint32_t> _batch_edges;
+    mutable std::vector<std::size_t> _batch_ends;
+};
+
+
+template<class Func>
+auto CompactHypergraph::forEachEdgeOf(std::uint64_t vtx, Func&& func) const
+    -> void
+{
+    _vertex_edges.forEach(vtx, std::forward<Func>(func));
+}
+
+template<class Func>
+auto CompactHypergraph::forEachVertexOf(std::uint64_t edge, Func&& func) const
+    -> void
+{
+    _edge_vertices.forEach(edge, std::forward<Func>(func));
+}
+
+} // namespace part
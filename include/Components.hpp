@@ -0,0 +1,53 @@
+#pragma once
+
+#include <CompactHypergraph.hpp>
+#include <SSet.hpp>
+#include <ThreadPool.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace part {
+
+//connected components of a hypergraph, two vertices are connected if they share an edge
+struct Components
+{
+    //smallest vertex of the component of every vertex, by dense id
+    std::vector<std::uint32_t> representative_of;
+    std::size_t number_of_components{0};
+};
+
+/**
+ * finds the connected components of @param graph with a union-find over its edges,
+ * the edges are split into ranges which are united in parallel on @param pool.
+ * a root is always linked below the smaller one, so every component ends up with its
+ * smallest vertex as representative, whatever order the threads unite in
+ */
+auto findComponents(const CompactHypergraph& graph,
+                    ThreadPool& pool)
+    -> Components;
+
+//vertices of the small components assigned wholesale to the partitions
+struct ComponentPacking
+{
+    //per partition, the packed vertices in ascending dense ids
+    std::vector<std::vector<int64_t>> vertices;
+    std::size_t packed_components{0};
+    std::size_t packed_vertices{0};
+};
+
+/**
+ * packs every component of @param graph whose load fits into a single partition
+ * into @param number_of_partitions bins, biggest component first, each into the
+ * last partition it still fits into, see BalanceMode for the load and the capacity
+ * of the partitions. components which fit nowhere are left to the neighbourhood
+ * expansion, which also fills up the rest of every partition,
+ * the last partitions are filled first, so the expansion of the big components
+ * starts on empty partitions and spreads over as few of them as possible
+ */
+auto packSmallComponents(const CompactHypergraph& graph,
+                         const Components& components,
+                         std::size_t number_of_partitions,
+                         BalanceMode balance_on)
+    -> ComponentPacking;
+
+} // namespace part
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <BlockingQueue.hpp>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace part {
+
+enum class Compression {
+    None,
+    Gzip,
+    Zstd // only readable if built with HYPE_WITH_ZSTD
+};
+
+//detects the compression of a file from its first bytes
+//exits if the file can not be opened
+auto detectCompression(const std::string& path)
+    -> Compression;
+
+//stream buffer handing out the decompressed content of a file.
+//the file is decompressed on its own thread into buffers of a fixed size,
+//which are passed through a bounded queue, so decompressing and parsing overlap
+//and at most a few buffers are held in memory
+class DecompressingStreamBuffer : public std::streambuf
+{
+public:
+    DecompressingStreamBuffer(const std::string& path,
+                              Compression compression,
+                              std::size_t buffer_size = 1 << 20,
+                              std::size_t number_of_buffers = 4);
+
+    //make stream buffers neither movable nor copyable,
+    //the thread works on the buffer itself
+    DecompressingStreamBuffer(DecompressingStreamBuffer&&) = delete;
+    DecompressingStreamBuffer(const DecompressingStreamBuffer&) = delete;
+    auto operator=(DecompressingStreamBuffer &&)
+        -> DecompressingStreamBuffer& = delete;
+    auto operator=(const DecompressingStreamBuffer&)
+        -> DecompressingStreamBuffer& = delete;
+
+    //stops decompressing if the content was not read to the end
+    ~DecompressingStreamBuffer() override;
+
+protected:
+    auto underflow()
+        -> int_type override;
+
+private:
+    auto decompressGzip()
+        -> void;
+    auto decompressZstd()
+        -> void;
+
+private:
+    const std::string _path;
+    const std::size_t _buffer_size;
+    BlockingQueue<std::vector<char>> _buffers;
+    std::vector<char> _current;
+    std::atomic<bool> _stop{false};
+    std::string _error; //written by the thread before the queue is closed
+    std::thread _thread;
+};
+
+//opens @param path for reading, gzip and zstd compressed files are decompressed on the fly
+//exits if the file can not be opened
+auto openInputFile(const std::string& path)
+    -> std::unique_ptr<std::istream>;
+
+} // namespace part
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Hypergraph.hpp>
+#include <Parsing.hpp>
+#include <string>
+
+namespace part {
+
+struct GeneratorConfig
+{
+    std::size_t number_of_vertices;
+    std::size_t number_of_edges;
+    //exponent of the power law the vertex degrees follow
+    double vertex_degree_exponent;
+    //exponent of the power law the edge sizes follow
+    double edge_size_exponent;
+    //edges have at least 2 and at most this many vertices
+    std::size_t max_edge_size;
+    uint32_t seed;
+};
+
+/**
+ * generates a random hypergraph in the style of the chung-lu model:
+ * every vertex gets a weight following a power law, every edge a size
+ * following a power law, and the vertices of an edge are drawn
+ * proportional to their weights. vertices are numbered from 1,
+ * vertices which are not drawn for any edge are still added to the graph.
+ * the same config always generates the same graph.
+ */
+auto generatePowerLawHypergraph(const GeneratorConfig& config)
+    -> Hypergraph;
+
+/**
+ * writes @param graph into a file in the given input format.
+ * for hmetis, the vertex ids have to be numbered from 1 and
+ * vertices without edges are lost.
+ */
+auto writeHypergraphFile(const Hypergraph& graph,
+                         const std::string& path,
+                         ParsingMode mode)
+    -> void;
+
+} // namespace part
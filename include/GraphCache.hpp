@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Adjacency.hpp>
+#include <CompactHypergraph.hpp>
+#include <Parsing.hpp>
+#include <Reordering.hpp>
+#include <filesystem>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace part {
+
+//keeps the compact adjacency of recently used hypergraph files in memory
+//the least recently used graphs are dropped when the memory budget is exceeded
+//graphs still in use by a running partitioning stay alive until it finishes
+class GraphCache
+{
+public:
+    //@param memory_budget bytes all cached graphs may use together
+    GraphCache(std::size_t memory_budget,
+               AdjacencyEncoding encoding,
+               VertexOrder order);
+
+    //returns the graph in the file at @param path, parses it if it is not cached
+    //or if the file was modified since it was cached
+    //graphs bigger than the whole budget are returned without being cached
+    auto get(const std::string& path,
+             ParsingMode mode)
+        -> std::shared_ptr<const CompactHypergraph>;
+
+    //bytes used by all cached graphs
+    auto memoryUsage() const
+        -> std::size_t;
+
+    //writes one line per cached graph, most recently used first
+    auto describe(std::ostream& out) const
+        -> void;
+
+private:
+    struct Entry
+    {
+        std::string key;
+        std::filesystem::file_time_type modified;
+        std::shared_ptr<const CompactHypergraph> graph;
+        std::size_t bytes;
+    };
+
+    //drops the least recently used graphs until @param bytes more fit into the budget
+    auto makeSpace(std::size_t bytes)
+        -> void;
+
+private:
+    std::size_t _memory_budget;
+    AdjacencyEncoding _encoding;
+    VertexOrder _order;
+
+    std::list<Entry> _entries; //most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> _index;
+    std::size_t _memory_usage{0};
+    mutable std::mutex _mutex;
+};
+
+} // namespace part
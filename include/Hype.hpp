@@ -0,0 +1,56 @@
+#pragma once
+
+#include <SSet.hpp>
+#include <cstdint>
+#include <vector>
+
+//public interface of libhype to partition hypergraphs held in memory by the caller
+
+namespace part {
+
+/**
+ * hypergraph in the caller's memory as csr arrays with dense ids,
+ * vertices are numbered 0 .. number_of_vertices - 1,
+ * edges 0 .. number_of_edges - 1.
+ * the pins of edge e are edge_pins[edge_offsets[e]] .. edge_pins[edge_offsets[e + 1] - 1],
+ * so edge_offsets has number_of_edges + 1 entries. an edge must not contain a vertex twice.
+ * the arrays are used in place, they have to stay valid while partitioning.
+ * the vertex side (vertex_offsets, vertex_edges) is optional in the same layout,
+ * without it, it is built from the edge side, which needs one copy of the pins.
+ * the edges of every vertex have to be sorted ascending and free of duplicates,
+ * and both sides have to contain the same pins.
+ */
+struct CsrHypergraph
+{
+    std::size_t number_of_vertices{0};
+    std::size_t number_of_edges{0};
+    const std::uint64_t* edge_offsets{nullptr};
+    const std::uint32_t* edge_pins{nullptr};
+    const std::uint64_t* vertex_offsets{nullptr};
+    const std::uint32_t* vertex_edges{nullptr};
+};
+
+//parameters of partitionGraph, see Partitioning.hpp
+struct PartitioningOptions
+{
+    std::size_t number_of_partitions{2};
+    std::size_t s_set_size{10};
+    std::size_t s_set_candidates{2};
+    double ignore_biggest_edges_in_percent{0};
+    NodeHeuristicMode num_neigs_flag{NodeHeuristicMode::Cached};
+    NodeSelectionMode node_select_flag{NodeSelectionMode::NextBest};
+    std::uint32_t seed{0};
+};
+
+/**
+ * partitions @param graph with neighbourhood expansion
+ * @return the partition of every vertex, indexed by vertex id
+ * @throws std::invalid_argument if the offsets are missing, do not start at 0,
+ * decrease or do not end at the number of pins, if an id is out of range
+ * or if the edges of a vertex are not sorted and unique
+ */
+auto partitionCsr(const CsrHypergraph& graph,
+                  const PartitioningOptions& options)
+    -> std::vector<std::uint32_t>;
+
+} // namespace part
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <random>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -54,6 +58,11 @@ public:
     auto getEdgesizeOfPercentBiggestEdge(double percent) const
         -> std::size_t;
 
+    //removes the biggest @param percent of the edges from the graph
+    //and returns them, the vertices stay in the graph
+    auto extractBiggestEdges(double percent)
+        -> EdgeMap;
+
     //connects the given vertex with the given edge
     //if vertex or edge dont exist in the graph
     //they get inserted
@@ -73,6 +82,31 @@ public:
     auto getVertices()
         -> VertexMap&;
 
+    //returns the number of vertices in the graph
+    auto numberOfVertices() const
+        -> std::size_t;
+
+    //returns the sum of the sizes of all edges
+    auto numberOfPins() const
+        -> std::size_t;
+
+    //sets the weight of a vertex, vertices without a weight weigh 1
+    //the weight is kept when the vertex is deleted
+    auto setVertexWeight(int64_t vtx,
+                         std::uint64_t weight)
+        -> void;
+
+    auto getVertexWeight(const int64_t& vtx) const
+        -> std::uint64_t;
+
+    //returns the weights set with setVertexWeight
+    auto getVertexWeights() const
+        -> const std::unordered_map<int64_t, std::uint64_t>&;
+
+    //returns the sum of the weights of all vertices in the graph
+    auto totalVertexWeight() const
+        -> std::uint64_t;
+
     //deletes given vertex
     //also makes sure no edge holds a reference to the
     //deleted vertex
@@ -110,6 +144,16 @@ public:
     auto getNodeHeuristicEstimate(const int64_t& vtx) const
         -> double;
 
+    //heuristics of all @param vertices, as the functions above return them one by one.
+    //the hash maps have no layout to prefetch from, so the vertices are computed in turn,
+    //see ResidualHypergraph for the batched version
+    auto getNodeHeuristicsExactly(const std::vector<int64_t>& vertices,
+                                  std::vector<double>& heuristics) const
+        -> void;
+    auto getNodeHeuristicsEstimate(const std::vector<int64_t>& vertices,
+                                   std::vector<double>& heuristics) const
+        -> void;
+
     //returns a random node of the graph
     auto getRandomNode() const
         -> int64_t;
@@ -119,11 +163,24 @@ public:
 
     static auto setSeed(uint32_t seed)
         -> void;
+    static auto getSeed()
+        -> uint32_t;
+
+    //writes the state which is not part of the graph itself,
+    //the cached heuristics and the random engine, for checkpoints
+    auto writeState(std::ostream& out) const
+        -> void;
+    //restores the state written by writeState
+    auto readState(std::istream& in)
+        -> void;
 
 private:
     EdgeMap _edges;
     VertexMap _vertices;
+    std::unordered_map<int64_t, std::uint64_t> _vertex_weights;
     mutable std::unordered_map<int64_t, double> _neigbour_map;
+    //seeded with the seed set at the first call of getRandomNode
+    mutable std::optional<std::mt19937> _engine;
     inline static uint32_t random_seed;
 };
 
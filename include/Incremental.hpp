@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Hypergraph.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace part {
+
+//partition of every vertex of a partitioned hypergraph
+struct Assignment
+{
+    std::unordered_map<int64_t, std::size_t> partition_of;
+    std::vector<std::size_t> sizes; //vertices per partition
+};
+
+/**
+ * reads an assignment from @param path, which is either
+ * - a partition file with one line per vertex, holding either only the partition
+ *   of the vertex whose id is the line number starting at 1 (like hMetis),
+ *   or the vertex id followed by its partition
+ * - or the prefix of the files written by HYPE -o, i.e. the input path,
+ *   if <path>_partition_0 exists
+ */
+auto readAssignment(const std::string& path)
+    -> Assignment;
+
+//writes one line "<vertex> <partition>" per vertex of @param assignment, ordered by vertex id
+auto writeAssignment(const Assignment& assignment,
+                     const std::string& path)
+    -> void;
+
+/**
+ * assigns every vertex of @param delta which is not yet in @param assignment.
+ * the new vertices connected to the most already assigned pins are placed first,
+ * each into the partition holding most of these pins,
+ * so the new vertices grow out of the existing partitions like in neighbourhood expansion.
+ * no partition gets more than the average number of vertices after the update, rounded up,
+ * unless it already had more before.
+ * edges of @param delta with more than @param max_edge_size vertices are not used to place vertices.
+ * only the delta is processed, the time does not depend on the size of the existing graph
+ * @return number of newly assigned vertices
+ */
+auto placeNewVertices(Assignment& assignment,
+                      const Hypergraph& delta,
+                      std::size_t max_edge_size)
+    -> std::size_t;
+
+} // namespace part
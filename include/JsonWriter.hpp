@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace part {
+
+//writes json into a stream while it is generated
+//takes care of the commas between the members of objects and arrays
+class JsonWriter
+{
+public:
+    explicit JsonWriter(std::ostream& out);
+
+    auto beginObject()
+        -> JsonWriter&;
+    auto endObject()
+        -> JsonWriter&;
+    auto beginArray()
+        -> JsonWriter&;
+    auto endArray()
+        -> JsonWriter&;
+
+    //key of the next member of the current object
+    auto key(const std::string& name)
+        -> JsonWriter&;
+
+    auto value(const std::string& str)
+        -> JsonWriter&;
+    auto value(const char* str)
+        -> JsonWriter&;
+
+    auto null()
+        -> JsonWriter&;
+
+    //numbers and bools, non finite numbers are written as null
+    template<class T>
+    auto value(T number)
+        -> std::enable_if_t<std::is_arithmetic_v<T>, JsonWriter&>;
+
+private:
+    //writes a comma if the current object or array already has a member
+    auto separate()
+        -> void;
+
+    std::ostream& _out;
+    std::vector<bool> _has_members;
+    bool _after_key{false};
+};
+
+
+template<class T>
+auto JsonWriter::value(T number)
+    -> std::enable_if_t<std::is_arithmetic_v<T>, JsonWriter&>
+{
+    separate();
+    if constexpr(std::is_same_v<T, bool>) {
+        _out << (number ? "true" : "false");
+    } else if constexpr(std::is_floating_point_v<T>) {
+        if(std::isfinite(number))
+            _out << number;
+        else
+            _out << "null";
+    } else {
+        _out << number;
+    }
+    return *this;
+}
+
+} // namespace part
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace part {
+
+//memory maps a whole file, the mapping is released on destruction
+class MappedFile
+{
+public:
+    //make mapped files move only
+    MappedFile(MappedFile&&) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    auto operator=(MappedFile &&) noexcept
+        -> MappedFile&;
+    auto operator=(const MappedFile&)
+        -> MappedFile& = delete;
+    ~MappedFile();
+
+    //maps the existing file at @param path read only
+    explicit MappedFile(const std::string& path);
+
+    //creates the file at @param path with @param size bytes
+    //and maps it writable
+    MappedFile(const std::string& path,
+               std::size_t size);
+
+    auto data() const
+        -> std::uint8_t*;
+
+    auto size() const
+        -> std::size_t;
+
+    //tells the kernel that the mapping is accessed randomly,
+    //which disables the read ahead of neighbouring pages
+    auto adviseRandomAccess() const
+        -> void;
+
+private:
+    std::uint8_t* _data{nullptr};
+    std::size_t _size{0};
+};
+
+} // namespace part
@@ -1,3 +1,5 @@
+#pragma once
+
 #include <Hypergraph.hpp>
 #include <boost/fusion/adapted/std_tuple.hpp>
 #include <boost/spirit/home/x3.hpp>
@@ -23,8 +25,66 @@ auto operator<<(std::ostream& os, const part::ParsingMode& mode)
     -> std::ostream&;
 
 
+//receives the content of a parsed hypergraph file
+//without building a Hypergraph
+class PinSink
+{
+public:
+    virtual ~PinSink() = default;
+
+    //edgelist: a vertex and all the edges it is connected to
+    virtual auto addEdgeList(const int64_t& vtx,
+                             const std::vector<int64_t>& edge_list)
+        -> void = 0;
+
+    //edgelist: a vertex without edges
+    virtual auto addVertex(int64_t vtx)
+        -> void = 0;
+
+    //hmetis: an edge and all vertices connected to it
+    virtual auto addNodeList(const int64_t& edge,
+                             const std::vector<int64_t>& node_list)
+        -> void = 0;
+
+    //bipartite: a single vertex edge connection
+    virtual auto connect(const int64_t& vtx,
+                         const int64_t& edge)
+        -> void = 0;
+
+    //hmetis with fmt 10 or 11: the weight of a vertex
+    //sinks which do not balance on weights ignore it
+    virtual auto setVertexWeight(int64_t /*vtx*/,
+                                 std::uint64_t /*weight*/)
+        -> void {}
+};
+
+//the files @param path stands for: all files of a directory except hidden ones
+//and ones starting with '_' like _SUCCESS markers, all files matching a glob pattern
+//or the file itself, sorted by name. exits if there is no such file
+auto expandInputPath(const std::string& path)
+    -> std::vector<std::string>;
+
+//hash of the absolute path, size and modification time of every file @param path
+//stands for, see expandInputPath. it changes if a file is replaced, touched or
+//another one is added, without reading the files
+auto inputFingerprint(const std::string& path)
+    -> std::uint64_t;
+
+//@param path can be a file, a directory or a glob pattern, see expandInputPath.
+//several files are parsed as shards of one hypergraph on @param number_of_threads threads,
+//0 uses all hardware threads. the result is the same as for the concatenated files,
+//with the edges of a hmetis shard numbered after the ones of the shards before
 auto parseFileIntoHypergraph(const std::string& path,
-                             ParsingMode mode)
+                             ParsingMode mode,
+                             std::size_t number_of_threads = 0)
     -> part::Hypergraph;
 
+//parses the file and passes its content to @param sink,
+//shards are handled like in parseFileIntoHypergraph
+auto parseFileIntoSink(const std::string& path,
+                       ParsingMode mode,
+                       PinSink& sink,
+                       std::size_t number_of_threads = 0)
+    -> void;
+
 } // namespace part
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <CompactHypergraph.hpp>
+#include <Partition.hpp>
+#include <ThreadPool.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace part {
+
+/**
+ * the part of a partitioned hypergraph a single partition needs to work on its own.
+ * its vertices get the local ids 0 .. n-1 in the order of the graph,
+ * its edges, which are all edges of these vertices, the local ids 0 .. m-1.
+ * a cut edge is held by every partition it spans, each with the pins of its own vertices.
+ * one of them owns the edge, the one with most of its pins, on a tie the smallest one,
+ * the others hold replicas of it
+ */
+struct SubHypergraph
+{
+    std::uint64_t partition{0};
+    std::uint64_t number_of_partitions{0};
+
+    //per local vertex
+    std::vector<int64_t> vertex_ids; //id in the whole graph
+    std::vector<std::uint64_t> vertex_weights;
+
+    //per local edge
+    std::vector<int64_t> edge_ids; //id in the whole graph
+    std::vector<std::uint32_t> edge_owners;
+
+    //local vertices of edge e are pins[pin_offsets[e] .. pin_offsets[e + 1]]
+    std::vector<std::uint64_t> pin_offsets;
+    std::vector<std::uint32_t> pins;
+
+    //partitions holding edge e, the owner first, empty if e is not cut
+    //they are replicas[replica_offsets[e] .. replica_offsets[e + 1]]
+    std::vector<std::uint64_t> replica_offsets;
+    std::vector<std::uint32_t> replicas;
+};
+
+/**
+ * writes the sub-hypergraph of every partition of @param graph into
+ * @param directory/partition_<id>.bin, the directory is created if needed.
+ * @param partitions are given in the original ids of @param graph and have to
+ * hold every vertex of it. the sub-hypergraphs are built in parallel on @param pool,
+ * every vertex and the edges of it are visited once by the partition holding it
+ */
+auto exportPartitions(const CompactHypergraph& graph,
+                      const std::vector<Partition>& partitions,
+                      const std::string& directory,
+                      ThreadPool& pool)
+    -> void;
+
+//file layout: magic | partition | number of partitions | every vector of SubHypergraph in order,
+//each as its length followed by its values, all in native byte order
+auto writeSubHypergraph(std::ostream& out,
+                        const SubHypergraph& subgraph)
+    -> void;
+
+//exits if the file at @param path does not hold a sub-hypergraph
+auto readSubHypergraph(const std::string& path)
+    -> SubHypergraph;
+
+} // namespace part
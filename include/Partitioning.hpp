@@ -1,8 +1,13 @@
 #pragma once
 
+#include <Checkpoint.hpp>
+#include <CompactHypergraph.hpp>
+#include <Components.hpp>
 #include <Hypergraph.hpp>
 #include <Partition.hpp>
+#include <Progress.hpp>
 #include <SSet.hpp>
+#include <Statistics.hpp>
 
 namespace part {
 
@@ -17,6 +22,16 @@ namespace part {
  * @param ignore_biggest_edges_in_percent the percentage of biggest edges
  *        which will be ignored when expanding the secondary set default is
  *        1, which means the biggest 1% of the edges will be ignored.
+ * @param stats if given, filled with the timings and counters of the
+ *        neighbourhood expansion
+ * @param progress if given, updated while partitioning, see ProgressReporter
+ * @param checkpoint if given, the state is written to a checkpoint periodically,
+ *        and with resume set, the run continues from an existing checkpoint
+ *        with the same result as an uninterrupted run
+ * @param balance_on what the partitions are balanced on, with vertices
+ *        the number of vertices of two partitions differs by at most 1,
+ *        with weights or pins every partition is filled up to the remaining
+ *        load divided by the remaining partitions
  *
  * @return a vector of partitions as result of partitioning the graph
  */
@@ -26,9 +41,76 @@ auto partitionGraph(Hypergraph&& graph,
                     std::size_t s_set_candidates,
                     double ignore_biggest_edges_in_percent,
                     NodeHeuristicMode num_neigs_flag,
-                    NodeSelectionMode node_select_flag)
+                    NodeSelectionMode node_select_flag,
+                    PartitioningStats* stats = nullptr,
+                    PartitioningProgress* progress = nullptr,
+                    const CheckpointSettings* checkpoint = nullptr,
+                    BalanceMode balance_on = BalanceMode::Vertices)
     -> std::vector<Partition>;
 
+/**
+ * same as above, but works on a compact hypergraph which is not modified,
+ * the returned partitions contain the original vertex and edge ids
+ * @param packing if given, its vertices are put into their partitions before
+ *        the neighbourhood expansion fills up the rest, see packSmallComponents.
+ *        it has to be packed for the same number of partitions and balance mode
+ */
+auto partitionGraph(const CompactHypergraph& graph,
+                    std::size_t number_of_partitions,
+                    std::size_t s_set_size,
+                    std::size_t s_set_candidates,
+                    double ignore_biggest_edges_in_percent,
+                    NodeHeuristicMode num_neigs_flag,
+                    NodeSelectionMode node_select_flag,
+                    PartitioningStats* stats = nullptr,
+                    PartitioningProgress* progress = nullptr,
+                    const CheckpointSettings* checkpoint = nullptr,
+                    BalanceMode balance_on = BalanceMode::Vertices,
+                    const ComponentPacking* packing = nullptr)
+    -> std::vector<Partition>;
+
+/**
+ * same as above, but random node selection is seeded with @param seed
+ * instead of the seed set with Hypergraph::setSeed.
+ * every call only reads @param graph, so several partitionings
+ * of the same graph can run in parallel
+ */
+auto partitionGraph(const CompactHypergraph& graph,
+                    std::size_t number_of_partitions,
+                    std::size_t s_set_size,
+                    std::size_t s_set_candidates,
+                    double ignore_biggest_edges_in_percent,
+                    NodeHeuristicMode num_neigs_flag,
+                    NodeSelectionMode node_select_flag,
+                    std::uint32_t seed,
+                    PartitioningStats* stats = nullptr,
+                    PartitioningProgress* progress = nullptr,
+                    const CheckpointSettings* checkpoint = nullptr,
+                    BalanceMode balance_on = BalanceMode::Vertices,
+                    const ComponentPacking* packing = nullptr)
+    -> std::vector<Partition>;
+
+/**
+ * replaces the vertex and edge ids of a relabelled graph in @param partitions
+ * with the original ids, see relabelHypergraph
+ * @param vertex_ids original id of every vertex
+ * @param edge_ids original id of every edge
+ */
+auto restoreOriginalIds(std::vector<Partition>& partitions,
+                        const std::vector<int64_t>& vertex_ids,
+                        const std::vector<int64_t>& edge_ids)
+    -> void;
+
+/**
+ * adds edges which were removed from the graph before partitioning
+ * to every partition holding one of their vertices,
+ * so that the metrics take them into account again
+ * @param pruned_edges the edges returned by Hypergraph::extractBiggestEdges
+ */
+auto restorePrunedEdges(std::vector<Partition>& partitions,
+                        const Hypergraph::EdgeMap& pruned_edges)
+    -> void;
+
 /**
  * @param partitions vector of partitions for which the sum of
  *        external degrees will be calculated
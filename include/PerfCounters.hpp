@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace part {
+
+//values of the hardware counters, empty if the counter could not be opened
+struct PerfCounts
+{
+    std::optional<std::uint64_t> cycles;
+    std::optional<std::uint64_t> instructions;
+    std::optional<std::uint64_t> llc_misses;
+    std::optional<std::uint64_t> branch_misses;
+};
+
+//hardware performance counters of the process opened with perf_event_open,
+//counting starts on construction and includes threads started afterwards
+//if the kernel denies access, the counters are simply not available
+class PerfCounters
+{
+public:
+    //make perf counters move only
+    PerfCounters(PerfCounters&&) noexcept;
+    PerfCounters(const PerfCounters&) = delete;
+    auto operator=(PerfCounters &&) noexcept
+        -> PerfCounters&;
+    auto operator=(const PerfCounters&)
+        -> PerfCounters& = delete;
+    ~PerfCounters();
+
+    PerfCounters();
+
+    //true if at least one counter could be opened
+    auto available() const
+        -> bool;
+
+    //counts since construction, scaled if the kernel had to multiplex the counters
+    auto read() const
+        -> PerfCounts;
+
+private:
+    auto readCounter(int fd) const
+        -> std::optional<std::uint64_t>;
+
+private:
+    //cycles, instructions, llc misses, branch misses
+    std::array<int, 4> _fds{-1, -1, -1, -1};
+};
+
+} // namespace part
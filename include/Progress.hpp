@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+namespace part {
+
+//state of a running partitioning, published by partitionGraph
+//the hot loop only writes it every few vertices with relaxed stores
+struct PartitioningProgress
+{
+    //how many vertices are assigned between two updates
+    static constexpr std::size_t update_interval{1024};
+
+    std::atomic<std::size_t> total_vertices{0};
+    std::atomic<std::size_t> number_of_partitions{0};
+    std::atomic<std::size_t> assigned_vertices{0};
+    std::atomic<std::size_t> current_partition{0};
+    std::atomic<std::size_t> sset_hits{0};
+};
+
+//prints the progress of a partitioning to @param out every @param interval
+//from its own thread, until it is destroyed
+class ProgressReporter
+{
+public:
+    ProgressReporter(const PartitioningProgress& progress,
+                     std::chrono::duration<double> interval,
+                     std::ostream& out = std::cerr);
+
+    //make progress reporters neither movable nor copyable,
+    //the thread works on the reporter itself
+    ProgressReporter(ProgressReporter&&) = delete;
+    ProgressReporter(const ProgressReporter&) = delete;
+    auto operator=(ProgressReporter &&)
+        -> ProgressReporter& = delete;
+    auto operator=(const ProgressReporter&)
+        -> ProgressReporter& = delete;
+    ~ProgressReporter();
+
+private:
+    auto run()
+        -> void;
+
+    //prints one line with throughput and eta
+    auto report(std::chrono::steady_clock::time_point now)
+        -> void;
+
+private:
+    const PartitioningProgress& _progress;
+    std::chrono::duration<double> _interval;
+    std::ostream& _out;
+
+    std::chrono::steady_clock::time_point _begin;
+    std::chrono::steady_clock::time_point _last_time;
+    std::size_t _last_assigned{0};
+
+    std::mutex _mutex;
+    std::condition_variable _stop_signal;
+    bool _stop{false};
+    std::thread _thread;
+};
+
+} // namespace part
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Hypergraph.hpp>
+#include <iostream>
+#include <vector>
+
+namespace part {
+
+enum class VertexOrder {
+    Input,  // keep the order of the parsed graph
+    Degree, // vertices with the most edges first
+    Bfs     // breadth first search, started at vertices with few edges
+};
+
+//needed to be able to parse commandline arguments
+//into the VertexOrder enum
+auto operator>>(std::istream& in, part::VertexOrder& order)
+    -> std::istream&;
+auto operator<<(std::ostream& os, const part::VertexOrder& order)
+    -> std::ostream&;
+
+//returns all vertices of @param graph in the given order
+//with VertexOrder::Input the iteration order of the graph is used
+auto computeVertexOrder(const Hypergraph& graph,
+                        VertexOrder order)
+    -> std::vector<int64_t>;
+
+//returns all edges of @param graph in the order
+//they are first reached when walking the vertices in @param vertex_order
+auto computeEdgeOrder(const Hypergraph& graph,
+                      const std::vector<int64_t>& vertex_order)
+    -> std::vector<int64_t>;
+
+struct RelabelledHypergraph
+{
+    Hypergraph graph;
+    std::vector<int64_t> vertex_ids; //original id of every vertex
+    std::vector<int64_t> edge_ids;   //original id of every edge
+};
+
+//renumbers the vertices of @param graph with 0,1,2... in the given order
+//and the edges in the order they are first reached
+//the new graph is built in that order, so that neighbours are
+//allocated close to each other
+auto relabelHypergraph(Hypergraph&& graph,
+                       const std::vector<int64_t>& vertex_order)
+    -> RelabelledHypergraph;
+
+} // namespace part
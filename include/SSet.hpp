@@ -16,6 +16,13 @@ enum class NodeSelectionMode {
     NextBest
 };
 
+//what the partitions are balanced on
+enum class BalanceMode {
+    Vertices, // number of vertices
+    Weight,   // sum of the vertex weights
+    Pins      // sum of the vertex degrees
+};
+
 //needed to be able to use the NodeHeuristicNode enum
 //as commandline arument
 auto operator>>(std::istream& in, part::NodeHeuristicMode& num)
@@ -26,11 +33,18 @@ auto operator>>(std::istream& in, part::NodeSelectionMode& num)
     -> std::istream&;
 auto operator<<(std::ostream& os, const part::NodeSelectionMode& num)
     -> std::ostream&;
+auto operator>>(std::istream& in, part::BalanceMode& mode)
+    -> std::istream&;
+auto operator<<(std::ostream& os, const part::BalanceMode& mode)
+    -> std::ostream&;
 
+//works on any graph with the interface of Hypergraph,
+//explicitly instantiated for Hypergraph and ResidualHypergraph
+template<class Graph = Hypergraph>
 class SSet
 {
 public:
-    SSet(const Hypergraph& graph,
+    SSet(const Graph& graph,
          std::size_t max_size,
          NodeHeuristicMode numb_of_neigs_flag,
          NodeSelectionMode node_select_flag)
@@ -48,19 +62,38 @@ public:
     auto getNextNode() const
         -> int64_t;
 
+    //if empty, getNextNode falls back to the node selection mode
+    auto isEmpty() const
+        -> bool;
+
     auto removeNode(const int64_t& node)
         -> void;
 
+    //writes the nodes in insertion order, which decides ties in getMinElement,
+    //for checkpoints
+    auto writeState(std::ostream& out) const
+        -> void;
+    //restores the nodes written by writeState in the same insertion order
+    auto readState(std::istream& in)
+        -> void;
+
 private:
     auto getNodeHeuristic(std::int64_t vtx) const
         -> std::size_t;
 
+    //the nodes paired with their heuristic, computed as one batch
+    auto getNodeHeuristics(const std::vector<int64_t>& nodes) const
+        -> std::vector<std::pair<int64_t, std::size_t>>;
+
     auto selectANode() const
         -> std::int64_t;
 
 private:
     std::unordered_set<int64_t> _nodes;
-    const Hypergraph& _graph;
+    //the nodes in the order they were inserted, getMinElement scans them in this order,
+    //so the choice does not depend on the buckets of _nodes
+    std::vector<int64_t> _insertion_order;
+    const Graph& _graph;
     std::size_t _max_size;
     NodeHeuristicMode _numb_of_neigs_flag;
     NodeSelectionMode _node_select_flag;
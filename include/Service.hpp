@@ -0,0 +1,58 @@
+#pragma once
+
+#include <GraphCache.hpp>
+#include <SSet.hpp>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace part {
+
+//parameters of the service which are not part of a request
+struct ServiceSettings
+{
+    std::size_t s_set_candidates;
+    double ignore_biggest_edges_in_percent;
+    NodeHeuristicMode num_neigs_flag;
+    NodeSelectionMode node_select_flag;
+    BalanceMode balance_on;
+    //used if a request does not give them
+    std::size_t default_s_set_size;
+    std::uint32_t default_seed;
+};
+
+/**
+ * answers the requests read line by line from @param in until it ends
+ * or a quit request arrives:
+ *
+ *   partition <path> <format> <partitions> [sset size] [seed]
+ *     one line "<vertex> <partition>" per vertex, then
+ *     "metrics <soed> <k-1> <hyperedge cut> <node balancing> <edge balancing>" and
+ *     "done <milliseconds>"
+ *   status
+ *     "cached <graphs> <bytes>", then one line per cached graph and "done"
+ *   quit
+ *
+ * malformed requests, and requests which fail like one on a malformed graph file,
+ * are answered with a single line "error <reason>", later requests are still served.
+ * graphs are taken from @param cache
+ */
+auto serveRequests(std::istream& in,
+                   std::ostream& out,
+                   GraphCache& cache,
+                   const ServiceSettings& settings)
+    -> void;
+
+/**
+ * listens on the unix socket at @param socket_path, a socket left there is replaced,
+ * exits if another file is in the way,
+ * and serves the requests of every connection with serveRequests.
+ * up to @param number_of_threads connections are served at the same time, never returns
+ */
+auto serveUnixSocket(const std::string& socket_path,
+                     std::size_t number_of_threads,
+                     GraphCache& cache,
+                     const ServiceSettings& settings)
+    -> void;
+
+} // namespace part
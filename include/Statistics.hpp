@@ -0,0 +1,83 @@
+#pragma once
+
+#include <JsonWriter.hpp>
+#include <PerfCounters.hpp>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace part {
+
+//resources used by one phase of a run
+struct PhaseStatistics
+{
+    std::string name;
+    double wall_seconds{0};
+    double cpu_seconds{0};      //of all threads of the process
+    std::size_t rss_bytes{0};      //resident memory at the end of the phase
+    std::size_t peak_rss_bytes{0}; //highest resident memory so far
+    std::optional<PerfCounts> counters; //only if hardware counters were requested
+};
+
+//counters of the neighbourhood expansion loop, see partitionGraph
+struct PartitioningStats
+{
+    //set before partitioning to measure both phases with hardware counters
+    bool perf_counters{false};
+
+    PhaseStatistics threshold; //computing the size of the biggest edges to ignore
+    PhaseStatistics expansion;
+
+    //next nodes taken from the secondary set
+    std::size_t sset_hits{0};
+    //next nodes chosen by the node selection mode because the secondary set was empty
+    std::size_t seed_fallbacks{0};
+    //candidates returned by getSSetCandidates and rated for the secondary set
+    std::size_t sset_candidates{0};
+    //vertices of small components assigned before the expansion, see packSmallComponents
+    std::size_t packed_vertices{0};
+    //load of every partition in what the partitions are balanced on, see BalanceMode
+    std::vector<std::uint64_t> partition_loads;
+};
+
+//measures the phase from its construction until stop is called
+//with @param perf_counters also the hardware counters, see PerfCounters
+class PhaseTimer
+{
+public:
+    explicit PhaseTimer(std::string name,
+                        bool perf_counters = false);
+
+    auto stop() const
+        -> PhaseStatistics;
+
+private:
+    std::string _name;
+    std::chrono::steady_clock::time_point _wall_begin;
+    double _cpu_begin;
+    std::optional<PerfCounters> _counters;
+};
+
+//cpu time used by all threads of the process in seconds
+auto processCpuSeconds()
+    -> double;
+
+//resident memory of the process in bytes
+auto currentRssBytes()
+    -> std::size_t;
+
+//highest resident memory of the process in bytes
+auto peakRssBytes()
+    -> std::size_t;
+
+//writes @param counts as json object, unavailable counters as null
+auto writePerfCounts(JsonWriter& json, const PerfCounts& counts)
+    -> void;
+
+//writes @param phase as json object
+auto writePhase(JsonWriter& json, const PhaseStatistics& phase)
+    -> void;
+
+} // namespace part
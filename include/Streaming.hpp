@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Parsing.hpp>
+#include <Partition.hpp>
+#include <string>
+#include <vector>
+
+namespace part {
+
+struct StreamedPartitioning
+{
+    std::vector<Partition> partitions;
+    std::size_t number_of_vertices;
+    std::size_t number_of_edges;
+};
+
+/**
+ * partitions the hypergraph file at @param path in a single pass
+ * without building the hypergraph.
+ * the file is parsed on its own thread, every vertex is assigned as soon
+ * as it arrives to the partition sharing the most hyperedges with it
+ * (min-max streaming) among the partitions having at most
+ * @param balance_slack more vertices than the smallest partition.
+ * only supports the edgelist and bipartite formats, since they deliver
+ * a vertex together with its edges, the edges of hmetis input are ignored,
+ * so the caller has to reject it before. in the bipartite format the lines of a
+ * vertex are expected to follow each other, a vertex appearing again later
+ * stays in the partition it was assigned to.
+ */
+auto partitionStream(const std::string& path,
+                     ParsingMode mode,
+                     std::size_t number_of_partitions,
+                     std::size_t balance_slack)
+    -> StreamedPartitioning;
+
+} // namespace part
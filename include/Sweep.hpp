@@ -0,0 +1,103 @@
+#pragma once
+
+#include <CompactHypergraph.hpp>
+#include <Partition.hpp>
+#include <SSet.hpp>
+#include <ThreadPool.hpp>
+#include <cstdint>
+#include <future>
+#include <iostream>
+#include <vector>
+
+namespace part {
+
+//metric by which the best run of a portfolio is chosen, smaller is better
+enum class PortfolioMetric {
+    KMinus1,
+    Soed,
+    HyperedgeCut
+};
+
+//needed to be able to parse commandline arguments
+//into the PortfolioMetric enum
+auto operator>>(std::istream& in, part::PortfolioMetric& metric)
+    -> std::istream&;
+auto operator<<(std::ostream& os, const part::PortfolioMetric& metric)
+    -> std::ostream&;
+
+//parameters which differ between the runs of a sweep
+struct RunConfiguration
+{
+    std::size_t number_of_partitions;
+    std::size_t s_set_size;
+    std::uint32_t seed;
+};
+
+//parameters shared by all runs of a sweep
+struct SweepSettings
+{
+    std::size_t s_set_candidates;
+    double ignore_biggest_edges_in_percent;
+    NodeHeuristicMode num_neigs_flag;
+    NodeSelectionMode node_select_flag;
+    BalanceMode balance_on;
+    //keep the partitions in the results, otherwise only the metrics are kept
+    bool keep_partitions;
+};
+
+struct RunResult
+{
+    RunConfiguration configuration;
+    std::vector<Partition> partitions; //empty unless SweepSettings::keep_partitions
+    std::size_t soed;
+    double vertex_balancing;
+    double edge_balancing;
+    std::size_t hyperedge_cut;
+    std::size_t k_minus_1;
+    double milliseconds; //partitioning only, without the metrics
+};
+
+//every combination of the given partition counts, secondary set sizes and seeds
+auto makeRunConfigurations(const std::vector<std::size_t>& partition_counts,
+                           const std::vector<std::size_t>& s_set_sizes,
+                           const std::vector<std::uint32_t>& seeds)
+    -> std::vector<RunConfiguration>;
+
+/**
+ * partitions @param graph once for every configuration on the threads of
+ * @param pool and computes the metrics of every run.
+ * the graph is shared read only between all runs.
+ * @return one future per configuration, in the order of @param configurations
+ */
+auto runConfigurations(const CompactHypergraph& graph,
+                       const std::vector<RunConfiguration>& configurations,
+                       const SweepSettings& settings,
+                       ThreadPool& pool)
+    -> std::vector<std::future<RunResult>>;
+
+//value of @param metric of the given run
+auto metricOf(const RunResult& result,
+              PortfolioMetric metric)
+    -> std::size_t;
+
+//distribution of a metric over the runs of a portfolio
+struct PortfolioSpread
+{
+    std::size_t min;
+    std::size_t max;
+    double mean;
+    double standard_deviation;
+};
+
+/**
+ * waits for all @param results and keeps the run with the smallest
+ * @param metric, ties are won by the earlier run.
+ * the partitions of all other runs are released as soon as they are compared
+ * @param spread receives the distribution of the metric over all runs
+ */
+auto selectBestRun(std::vector<std::future<RunResult>>& results,
+                   PortfolioMetric metric,
+                   PortfolioSpread& spread)
+    -> RunResult;
+
+} // namespace part
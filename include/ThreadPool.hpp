@@ -0,0 +1,121 @@
+#pragma once
+
+#include <BlockingQueue.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace part {
+
+//fixed number of threads working off a queue of tasks
+//the destructor waits until all submitted tasks are done
+class ThreadPool
+{
+public:
+    //@param number_of_threads 0 uses one thread per hardware thread
+    explicit ThreadPool(std::size_t number_of_threads);
+
+    //make thread pools neither movable nor copyable,
+    //the threads work on the pool itself
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool(const ThreadPool&) = delete;
+    auto operator=(ThreadPool &&)
+        -> ThreadPool& = delete;
+    auto operator=(const ThreadPool&)
+        -> ThreadPool& = delete;
+    ~ThreadPool();
+
+    auto numberOfThreads() const
+        -> std::size_t;
+
+    //runs @param func on one of the threads
+    //@return future holding the result of func
+    template<class Func>
+    auto submit(Func&& func)
+        -> std::future<std::invoke_result_t<Func>>;
+
+private:
+    auto work()
+        -> void;
+
+private:
+    BlockingQueue<std::function<void()>> _tasks;
+    std::vector<std::thread> _threads;
+};
+
+
+//ids are split into this many ranges per thread, so that uneven ranges even out
+constexpr std::size_t ranges_per_thread{4};
+
+//calls @param func(begin, end) on @param pool for ranges covering 0 .. size
+//and waits for all of them
+//@return the results of func in the order of the ranges, unless func returns void
+template<class Func>
+auto forEachRange(std::size_t size,
+                  ThreadPool& pool,
+                  Func&& func);
+
+//seed of the task @param task of a run seeded with @param seed,
+//it only depends on both, not on which thread runs the task or when,
+//and tasks of the same run do not share their random numbers
+inline auto taskSeed(std::uint32_t seed,
+                     std::uint64_t task)
+    -> std::uint32_t
+{
+    std::seed_seq sequence{seed,
+                           static_cast<std::uint32_t>(task),
+                           static_cast<std::uint32_t>(task >> 32)};
+    std::uint32_t derived;
+    sequence.generate(&derived, &derived + 1);
+    return derived;
+}
+
+
+template<class Func>
+auto ThreadPool::submit(Func&& func)
+    -> std::future<std::invoke_result_t<Func>>
+{
+    //std::function needs a copyable callable, packaged tasks are move only
+    auto task = std::make_shared<std::packaged_task<std::invoke_result_t<Func>()>>(std::forward<Func>(func));
+    auto result = task->get_future();
+    _tasks.push([task] { (*task)(); });
+    return result;
+}
+
+template<class Func>
+auto forEachRange(std::size_t size,
+                  ThreadPool& pool,
+                  Func&& func)
+{
+    using Result = std::invoke_result_t<Func, std::size_t, std::size_t>;
+
+    const auto number_of_ranges = pool.numberOfThreads() * ranges_per_thread;
+    const auto step = std::max<std::size_t>((size + number_of_ranges - 1) / number_of_ranges, 1);
+
+    std::vector<std::future<Result>> futures;
+    for(std::size_t begin{0}; begin < size; begin += step) {
+        futures.push_back(pool.submit([&func, begin, end = std::min(begin + step, size)] {
+            return func(begin, end);
+        }));
+    }
+
+    if constexpr(std::is_void_v<Result>) {
+        for(auto&& future : futures) {
+            future.get();
+        }
+    } else {
+        std::vector<Result> results;
+        for(auto&& future : futures) {
+            results.push_back(future.get());
+        }
+        return results;
+    }
+}
+
+} // namespace part
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <Adjacency.hpp>
+#include <Hypergraph.hpp>
+#include <Partition.hpp>
+#include <SSet.hpp>
+#include <ThreadPool.hpp>
+#include <cstdint>
+#include <future>
+#include <iostream>
+#include <vector>
+
+namespace part {
+
+//layout of the machines the partitions are mapped onto, like 8x2x16
+//for 8 machines with 2 sockets each and 16 cores per socket
+struct Topology
+{
+    //number of parts every part of the level above is split into, outermost level first
+    std::vector<std::size_t> levels;
+
+    //product of all levels
+    auto numberOfPartitions() const
+        -> std::size_t;
+};
+
+//needed to be able to parse commandline arguments
+//into the Topology struct
+auto operator>>(std::istream& in, part::Topology& topology)
+    -> std::istream&;
+auto operator<<(std::ostream& os, const part::Topology& topology)
+    -> std::ostream&;
+
+//parameters of every partitioning of a hierarchical run, see partitionGraph
+struct TopologySettings
+{
+    std::size_t s_set_size;
+    std::size_t s_set_candidates;
+    double ignore_biggest_edges_in_percent;
+    NodeHeuristicMode num_neigs_flag;
+    NodeSelectionMode node_select_flag;
+    BalanceMode balance_on;
+    //adjacency the graph of every part is partitioned on
+    AdjacencyEncoding encoding;
+    std::uint32_t seed;
+};
+
+/**
+ * partitions @param graph level by level: first into the parts of the outermost level,
+ * then the subgraph of every part into the parts of the next level and so on,
+ * so that the vertices of a machine are split among its sockets and so on.
+ * the parts of a level are partitioned in parallel on @param pool,
+ * each with its own seed derived from settings.seed, the level and its index, see taskSeed.
+ * @return topology.numberOfPartitions() partitions, the id of a partition is the
+ *         index of its core, counted through the levels, e.g. with 8x2x16
+ *         machine m, socket s and core c get 32*m + 16*s + c.
+ *         every partition holds all edges of its vertices, like with partitionGraph
+ */
+auto partitionTopology(const Hypergraph& graph,
+                       const Topology& topology,
+                       const TopologySettings& settings,
+                       ThreadPool& pool)
+    -> std::vector<Partition>;
+
+//cost of a link on every level, the innermost level costs 1
+//and every level above 10 times as much as the one below
+auto defaultLinkCosts(const Topology& topology)
+    -> std::vector<std::size_t>;
+
+/**
+ * communication cost of @param partitions, mapped onto @param topology by their ids.
+ * an edge spanning p machines needs p - 1 links between machines,
+ * inside every machine it spans, the sockets it spans minus 1 links between sockets and so on,
+ * every link costs the @param link_costs of its level.
+ * with all costs 1 this is the K-1 metric
+ */
+auto getTopologyCost(const std::vector<Partition>& partitions,
+                     const Topology& topology,
+                     const std::vector<std::size_t>& link_costs)
+    -> std::future<std::size_t>;
+
+} // namespace part
@@ -1,10 +1,33 @@
+#include <AdjacencyFile.hpp>
+#include <AutoTuning.hpp>
+#include <CompactHypergraph.hpp>
+#include <Components.hpp>
 #include <Hypergraph.hpp>
+#include <Incremental.hpp>
+#include <JsonWriter.hpp>
 #include <Parsing.hpp>
 #include <Partition.hpp>
+#include <PartitionExport.hpp>
 #include <Partitioning.hpp>
+#include <PerfCounters.hpp>
+#include <Progress.hpp>
+#include <Reordering.hpp>
+#include <Service.hpp>
 #include <SSet.hpp>
+#include <Statistics.hpp>
+#include <Streaming.hpp>
+#include <Sweep.hpp>
+#include <ThreadPool.hpp>
+#include <Topology.hpp>
+#include <algorithm>
 #include <boost/program_options.hpp>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <sstream>
 #include <string>
 
 
@@ -28,9 +51,13 @@ auto main(int argc, char const* argv[])
          po::bool_switch()->default_value(false),
          "write the final partitions into files")
 
+        ("export-partitions",
+         po::value<std::string>(),
+         "write a binary sub-hypergraph of every partition into the given directory")
+
         ("input,i",
          po::value<std::string>(),
-         "input hypergraph file")
+         "input hypergraph file, a directory or a glob pattern of shards parsed in parallel")
 
         ("format,f",
          po::value<part::ParsingMode>()->default_value(part::ParsingMode::EdgeList),
@@ -52,25 +79,209 @@ auto main(int argc, char const* argv[])
          po::value<double>()->default_value(0),
          "how many percent of the biggest edges will be removed")
 
+        ("percent-of-edges-pruned",
+         po::value<double>()->default_value(0),
+         "how many percent of the biggest edges will be removed from the graph before partitioning, they are only used for the metrics")
+
         ("node-select-mode,m",
          po::value<part::NodeSelectionMode>()->default_value(part::NodeSelectionMode::NextBest),
          "specifies how the a node will be choosen to when sset is empty")
 
+        ("balance-on",
+         po::value<part::BalanceMode>()->default_value(part::BalanceMode::Vertices),
+         "balance the partitions on the number of vertices, the vertex weights of a hmetis file or the number of pins: vertices|weight|pins")
+
         ("seed,x",
          po::value<std::uint32_t>()->default_value(0),
          "seed used to initialze random number generators if used")
 
         ("heuristic-calc-method,c",
          po::value<part::NodeHeuristicMode>()->default_value(part::NodeHeuristicMode::Cached),
-         "Switch to choose between exact and cached calculation for the node heuristic");
+         "Switch to choose between exact and cached calculation for the node heuristic")
+
+        ("compact-adjacency,a",
+         po::value<part::AdjacencyEncoding>(),
+         "partition on a read only copy of the graph whose adjacency is stored as csr or delta-varint compressed (varint)")
+
+        ("adjacency-file,d",
+         po::value<std::string>(),
+         "partition out of core on the compact adjacency memory mapped from this file, the file is built from the input if it does not exist")
+
+        ("pack-components",
+         po::bool_switch()->default_value(false),
+         "assign connected components which fit into a partition wholesale, only the bigger ones are partitioned by neighbourhood expansion (implies a compact graph)")
+
+        ("reorder",
+         po::value<part::VertexOrder>()->default_value(part::VertexOrder::Input),
+         "renumber vertices and edges before partitioning, so that neighbours are close in memory (none, degree or bfs)")
+
+        ("streaming,t",
+         po::bool_switch()->default_value(false),
+         "assign every vertex in a single pass while parsing, without building the graph (edgelist and bipartite only)")
+
+        ("streaming-slack",
+         po::value<std::size_t>()->default_value(100),
+         "in streaming mode, maximum number of vertices a partition may have more than the smallest one")
+
+        ("stats-json",
+         po::value<std::string>(),
+         "write wall and cpu time, memory usage and counters of every phase as json into this file")
+
+        ("perf-counters",
+         po::bool_switch()->default_value(false),
+         "measure cycles, instructions, llc misses and branch misses of every phase with hardware performance counters")
+
+        ("auto",
+         po::bool_switch()->default_value(false),
+         "choose -s, -n and -e by trial partitionings of a sample of the graph, within the time of --auto-budget")
+
+        ("auto-budget",
+         po::value<double>()->default_value(600),
+         "with --auto, seconds the partitioning of the whole graph may take")
+
+        ("progress",
+         po::value<double>()->default_value(0),
+         "print the progress of partitioning to stderr every this many seconds, 0 disables it")
+
+        ("checkpoint",
+         po::value<std::string>(),
+         "write the state of the partitioning to this file periodically, so the run can be resumed with --resume")
+
+        ("checkpoint-interval",
+         po::value<double>()->default_value(600),
+         "seconds between two checkpoints")
+
+        ("resume",
+         po::bool_switch()->default_value(false),
+         "continue from the file given with --checkpoint if it exists, the graph is parsed again with the same options")
+
+        ("sweep-partitions",
+         po::value<std::vector<std::size_t>>()->multitoken(),
+         "partition the graph once for every given number of partitions in parallel and print one row per run, replaces -p")
+
+        ("sweep-sset-sizes",
+         po::value<std::vector<std::size_t>>()->multitoken(),
+         "in a sweep, also run every given maximum size of the secondary set instead of only -s")
+
+        ("sweep-seeds",
+         po::value<std::vector<std::uint32_t>>()->multitoken(),
+         "in a sweep, also run every given seed instead of only -x")
+
+        ("portfolio",
+         po::value<std::size_t>()->default_value(0),
+         "partition the graph this many times in parallel with the seeds -x, -x + 1, ... and keep the best result")
+
+        ("portfolio-metric",
+         po::value<part::PortfolioMetric>()->default_value(part::PortfolioMetric::KMinus1),
+         "metric which decides the best result of a portfolio (k-1, soed or cut)")
+
+        ("topology",
+         po::value<part::Topology>(),
+         "partition level by level for a machine layout like 8x2x16 (machines x sockets x cores), replaces -p")
+
+        ("topology-costs",
+         po::value<std::vector<std::size_t>>()->multitoken(),
+         "cost of a link on every level of --topology, outermost first, defaults to 10 times the cost of the level below, 1 on the innermost")
+
+        ("serve",
+         po::value<std::string>(),
+         "run as service answering partition requests on this unix socket, or on stdin and stdout if it is -")
+
+        ("cache-memory",
+         po::value<std::size_t>()->default_value(4096),
+         "as service, MiB the cached graphs may use together")
+
+        ("delta",
+         po::value<std::string>(),
+         "hypergraph file in the format given with -f, whose vertices missing in --assignment are added to the existing partitions")
+
+        ("assignment",
+         po::value<std::string>(),
+         "with --delta, the existing partitioning: a file with the partition of every vertex, or the input path of a run with -o")
+
+        ("assignment-output",
+         po::value<std::string>(),
+         "with --delta, file the updated assignment is written to, defaults to the delta file with .part appended")
+
+        ("threads",
+         po::value<std::size_t>()->default_value(0),
+         "number of threads used for parallel runs, 0 uses all hardware threads");
     // clang-format on
 
     po::variables_map vm{};
     po::store(po::command_line_parser(argc, argv).options(description).run(), vm);
     po::notify(vm);
 
+    if(vm.count("serve") && !vm.count("help")) {
+        part::GraphCache cache{vm["cache-memory"].as<std::size_t>() * 1024 * 1024,
+                               vm.count("compact-adjacency")
+                                   ? vm["compact-adjacency"].as<part::AdjacencyEncoding>()
+                                   : part::AdjacencyEncoding::Plain,
+                               vm["reorder"].as<part::VertexOrder>()};
+        const part::ServiceSettings settings{vm["nh-expand-candidates"].as<std::size_t>(),
+                                             vm["percent-of-edges-ignored"].as<double>(),
+                                             vm["heuristic-calc-method"].as<part::NodeHeuristicMode>(),
+                                             vm["node-select-mode"].as<part::NodeSelectionMode>(),
+                                             vm["balance-on"].as<part::BalanceMode>(),
+                                             vm["sset-size"].as<std::size_t>(),
+                                             vm["seed"].as<std::uint32_t>()};
+
+        auto socket_path = vm["serve"].as<std::string>();
+        if(socket_path == "-") {
+            part::serveRequests(std::cin, std::cout, cache, settings);
+        } else {
+            part::serveUnixSocket(socket_path, vm["threads"].as<std::size_t>(), cache, settings);
+        }
+        return 0;
+    }
+
+    if(vm.count("delta") && !vm.count("help")) {
+        if(!vm.count("assignment")) {
+            std::cout << "--delta needs the existing partitioning given with --assignment\n";
+            return 0;
+        }
+
+        auto delta_path = vm["delta"].as<std::string>();
+        auto output_path = vm.count("assignment-output")
+            ? vm["assignment-output"].as<std::string>()
+            : delta_path + ".part";
+
+        auto begin = std::chrono::steady_clock::now();
+
+        auto assignment = part::readAssignment(vm["assignment"].as<std::string>());
+        auto delta = part::parseFileIntoHypergraph(delta_path, vm["format"].as<part::ParsingMode>());
+
+        //like -e during expansion, the biggest edges can be ignored
+        auto ignored_percent = vm["percent-of-edges-ignored"].as<double>();
+        auto max_edge_size = ignored_percent > 0 && !delta.getEdges().empty()
+            ? delta.getEdgesizeOfPercentBiggestEdge(ignored_percent)
+            : std::numeric_limits<std::size_t>::max();
+
+        auto placing_begin = std::chrono::steady_clock::now();
+        auto placed = part::placeNewVertices(assignment, delta, max_edge_size);
+        auto placing_end = std::chrono::steady_clock::now();
+
+        part::writeAssignment(assignment, output_path);
+        auto end = std::chrono::steady_clock::now();
+
+        std::cout << placed
+                  << " new vertices placed into "
+                  << assignment.sizes.size()
+                  << " partitions in "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(placing_end - placing_begin).count()
+                  << " milliseconds, "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count()
+                  << " milliseconds in total\n"
+                  << "partition sizes:";
+        for(auto&& size : assignment.sizes) {
+            std::cout << " " << size;
+        }
+        std::cout << "\nupdated assignment written to " << output_path << std::endl;
+        return 0;
+    }
+
     if(!vm.count("input")
-       || !vm.count("partitions")
+       || (!vm.count("partitions") && !vm.count("sweep-partitions") && !vm.count("topology"))
        || !vm.count("format")
        || vm.count("help")) {
 
@@ -80,15 +291,105 @@ auto main(int argc, char const* argv[])
 
     auto input_path = vm["input"].as<std::string>();
     auto format = vm["format"].as<part::ParsingMode>();
-    auto partitions = vm["partitions"].as<std::size_t>();
+    auto sweep = vm.count("sweep-partitions") > 0;
+    auto topology = vm.count("topology")
+        ? std::optional<part::Topology>{vm["topology"].as<part::Topology>()}
+        : std::nullopt;
+    auto partitions = sweep
+        ? 0
+        : topology ? topology->numberOfPartitions() : vm["partitions"].as<std::size_t>();
     auto ssize = vm["sset-size"].as<std::size_t>();
     auto percent = vm["percent-of-edges-ignored"].as<double>();
+    auto pruned_percent = vm["percent-of-edges-pruned"].as<double>();
     auto numb_of_neigs_flag = vm["heuristic-calc-method"].as<part::NodeHeuristicMode>();
     auto node_select_flag = vm["node-select-mode"].as<part::NodeSelectionMode>();
+    auto balance_on = vm["balance-on"].as<part::BalanceMode>();
     auto raw = vm["raw"].as<bool>();
     auto output = vm["output"].as<bool>();
     auto numb_of_can = vm["nh-expand-candidates"].as<std::size_t>();
     auto seed = vm["seed"].as<std::uint32_t>();
+    auto compact = vm.count("compact-adjacency") > 0;
+    auto out_of_core = vm.count("adjacency-file") > 0;
+    auto streaming = vm["streaming"].as<bool>();
+    auto slack = vm["streaming-slack"].as<std::size_t>();
+    auto order = vm["reorder"].as<part::VertexOrder>();
+    auto perf_counters = vm["perf-counters"].as<bool>();
+    auto progress_interval = vm["progress"].as<double>();
+    auto auto_tune = vm["auto"].as<bool>();
+    auto pack_components = vm["pack-components"].as<bool>();
+    auto checkpointing = vm.count("checkpoint") > 0;
+    auto resume = vm["resume"].as<bool>();
+    auto threads = vm["threads"].as<std::size_t>();
+    auto portfolio = vm["portfolio"].as<std::size_t>();
+    auto portfolio_metric = vm["portfolio-metric"].as<part::PortfolioMetric>();
+    //several runs share one read only compact graph
+    auto parallel_runs = sweep || portfolio > 0;
+    auto encoding = compact
+        ? vm["compact-adjacency"].as<part::AdjacencyEncoding>()
+        : part::AdjacencyEncoding::Plain;
+
+    //without a list, a sweep uses the single value of the option
+    auto sweep_list = [&vm](const std::string& name, auto single) {
+        using Value = decltype(single);
+        return vm.count(name)
+            ? vm[name].as<std::vector<Value>>()
+            : std::vector<Value>{single};
+    };
+    auto sweep_partitions = sweep_list("sweep-partitions", std::size_t{0});
+    auto sweep_sset_sizes = sweep_list("sweep-sset-sizes", ssize);
+    auto sweep_seeds = sweep_list("sweep-seeds", seed);
+
+    if(streaming && format == part::ParsingMode::Hmetis) {
+        std::cout << "streaming partitioning does not support the hmetis format\n";
+        std::exit(-1);
+    }
+
+    if(parallel_runs && streaming) {
+        std::cout << "sweeps and portfolios can not be combined with streaming partitioning\n";
+        std::exit(-1);
+    }
+
+    if(topology && (streaming || out_of_core || parallel_runs || checkpointing)) {
+        std::cout << "a topology can not be combined with streaming, adjacency files, sweeps, portfolios or checkpoints\n";
+        std::exit(-1);
+    }
+
+    auto link_costs = topology
+        ? (vm.count("topology-costs")
+               ? vm["topology-costs"].as<std::vector<std::size_t>>()
+               : part::defaultLinkCosts(*topology))
+        : std::vector<std::size_t>{};
+    if(topology && link_costs.size() != topology->levels.size()) {
+        std::cout << "--topology-costs needs one cost for every level of the topology\n";
+        std::exit(-1);
+    }
+
+    if(auto_tune && (streaming || parallel_runs || topology)) {
+        std::cout << "--auto can not be combined with streaming, sweeps, portfolios or topologies\n";
+        std::exit(-1);
+    }
+
+    if(pack_components && (streaming || parallel_runs || topology || checkpointing)) {
+        std::cout << "--pack-components can not be combined with streaming, sweeps, portfolios, topologies or checkpoints\n";
+        std::exit(-1);
+    }
+
+    //only the single run of neighbourhood expansion reports its progress
+    if(progress_interval > 0 && (streaming || parallel_runs || topology)) {
+        std::cout << "--progress can not be combined with streaming, sweeps, portfolios or topologies\n";
+        std::exit(-1);
+    }
+
+    auto exporting = vm.count("export-partitions") > 0;
+    if(exporting && streaming) {
+        std::cout << "--export-partitions can not be combined with streaming partitioning\n";
+        std::exit(-1);
+    }
+
+    if(resume && !checkpointing) {
+        std::cout << "--resume needs the checkpoint file given with --checkpoint\n";
+        std::exit(-1);
+    }
 
 
 
@@ -97,9 +398,15 @@ auto main(int argc, char const* argv[])
                   << "Partitioning Graph: "
                   << input_path
                   << "\n"
-                  << "into "
-                  << partitions
-                  << " partitions\n"
+                  << "into ";
+        if(sweep) {
+            for(auto&& k : sweep_partitions) {
+                std::cout << k << " ";
+            }
+        } else {
+            std::cout << partitions << " ";
+        }
+        std::cout << "partitions\n"
                   << "max secondary set size: "
                   << ssize
                   << "\n"
@@ -112,26 +419,146 @@ auto main(int argc, char const* argv[])
                   << "if sset is emtpy, new nodes will be selected: "
                   << node_select_flag
                   << "\n"
-                  << "----------------------------------------------------------------------------\n";
+                  << "partitions will be balanced on: "
+                  << balance_on
+                  << (streaming && balance_on != part::BalanceMode::Vertices ? " (ignored in this mode)" : "")
+                  << "\n";
+        if(streaming) {
+            std::cout << "vertices will be assigned while parsing, with a balance slack of "
+                      << slack
+                      << "\n";
+        } else if(out_of_core) {
+            std::cout << "adjacency will be memory mapped from: "
+                      << vm["adjacency-file"].as<std::string>()
+                      << "\n";
+        } else if(compact) {
+            std::cout << "adjacency will be stored compact as: "
+                      << encoding
+                      << "\n";
+        }
+        if(pruned_percent > 0) {
+            std::cout << "before partitioning, the biggest "
+                      << pruned_percent
+                      << "% of edges will be removed from the graph"
+                      << (streaming || out_of_core || parallel_runs ? " (ignored in this mode)" : "")
+                      << "\n";
+        }
+        if(sweep) {
+            std::cout << "every combination of partitions, secondary set sizes and seeds will be run in parallel on a read only compact graph\n";
+        } else if(portfolio > 0) {
+            std::cout << "the graph will be partitioned "
+                      << portfolio
+                      << " times in parallel, keeping the result with the best "
+                      << portfolio_metric
+                      << "\n";
+            if(node_select_flag != part::NodeSelectionMode::TrulyRandom) {
+                std::cout << "without -m truly-random all runs of the portfolio will have the same result\n";
+            }
+        }
+        if(topology) {
+            std::cout << "the graph will be partitioned level by level for the topology "
+                      << *topology
+                      << ", with link costs";
+            for(auto&& cost : link_costs) {
+                std::cout << " " << cost;
+            }
+            std::cout << "\n";
+        }
+        if(pack_components) {
+            std::cout << "connected components which fit into a partition will be assigned wholesale\n";
+        }
+        if(order != part::VertexOrder::Input) {
+            std::cout << "vertices and edges will be reordered: "
+                      << order
+                      << (streaming || out_of_core ? " (ignored in this mode)" : "")
+                      << "\n";
+        }
+        if(checkpointing) {
+            std::cout << "the state will be written to "
+                      << vm["checkpoint"].as<std::string>()
+                      << " every "
+                      << vm["checkpoint-interval"].as<double>()
+                      << " seconds"
+                      << (streaming || parallel_runs ? " (ignored in this mode)" : "")
+                      << "\n";
+            if(resume && !streaming && !parallel_runs) {
+                std::cout << (std::filesystem::exists(vm["checkpoint"].as<std::string>())
+                                  ? "the partitioning will be resumed from it"
+                                  : "there is no checkpoint yet, the partitioning starts from scratch")
+                          << "\n";
+            }
+        }
+        if(perf_counters) {
+            std::cout << (part::PerfCounters{}.available()
+                              ? "every phase will be measured with hardware performance counters"
+                              : "hardware performance counters are not available, they will not be measured")
+                      << "\n";
+        }
+        std::cout << "----------------------------------------------------------------------------\n";
 
         std::cout << "parsing graph ...\n";
     }
 
     part::Hypergraph::setSeed(seed);
 
+    std::vector<part::PhaseStatistics> phases;
+    part::PartitioningStats partitioning_stats;
+    partitioning_stats.perf_counters = perf_counters;
+
     auto begin = std::chrono::steady_clock::now();
+    part::PhaseTimer parse_timer{streaming ? "streaming" : "parse", perf_counters};
+
+    part::Hypergraph graph;
+    std::optional<part::CompactHypergraph> compact_graph;
+    std::vector<part::Partition> parts;
+    std::size_t number_of_nodes;
+    std::size_t number_of_edges;
 
-    auto graph = part::parseFileIntoHypergraph(input_path, format);
-    auto number_of_nodes = graph.getVertices().size();
-    auto number_of_edges = graph.getEdges().size();
+    if(streaming) {
+        //parsing and partitioning happen in the same pass
+        auto streamed = part::partitionStream(input_path, format, partitions, slack);
+        parts = std::move(streamed.partitions);
+        number_of_nodes = streamed.number_of_vertices;
+        number_of_edges = streamed.number_of_edges;
+    } else if(out_of_core) {
+        auto file_path = vm["adjacency-file"].as<std::string>();
+        auto exists = std::filesystem::exists(file_path);
 
+        //a file of another input or format is built again,
+        //files which are no adjacency files are left to mapAdjacencyFile to reject
+        auto source = exists ? part::readAdjacencyFileSource(file_path) : std::nullopt;
+        auto outdated = source
+            && (source->input_fingerprint != part::inputFingerprint(input_path)
+                || source->format != format);
+        if(outdated && !raw) {
+            std::cout << "adjacency file " << file_path << " was built from another input, it is built again\n";
+        }
+
+        if(!exists || outdated) {
+            part::buildAdjacencyFile(input_path, format, file_path, encoding);
+        } else if(source && compact && source->encoding != encoding) {
+            std::cout << "file: " << file_path << " is stored as " << source->encoding
+                      << ", -a " << encoding << " does not match it\n";
+            std::exit(-1);
+        }
+
+        compact_graph = part::mapAdjacencyFile(file_path);
+        number_of_nodes = compact_graph->numberOfVertices();
+        number_of_edges = compact_graph->numberOfEdges();
+    } else {
+        graph = part::parseFileIntoHypergraph(input_path, format, threads);
+        number_of_nodes = graph.getVertices().size();
+        number_of_edges = graph.getEdges().size();
+    }
+
+    phases.push_back(parse_timer.stop());
     auto end = std::chrono::steady_clock::now();
     auto parsing_time =
         std::chrono::duration_cast<std::chrono::milliseconds>(end - begin)
             .count();
 
     if(!raw) {
-        std::cout << "graph parsed in "
+        std::cout << (streaming ? "graph parsed and partitioned in " : "graph parsed in ")
                   << parsing_time
                   << " milliseconds\n"
                   << "#Nodes:\t"
@@ -147,25 +574,298 @@ auto main(int argc, char const* argv[])
 
 
     begin = std::chrono::steady_clock::now();
-    auto parts = part::partitionGraph(std::move(graph),
-                                      partitions,
-                                      ssize,
-                                      numb_of_can,
-                                      percent,
-                                      numb_of_neigs_flag,
-                                      node_select_flag);
+    part::PhaseTimer build_timer{"build", perf_counters};
+
+    //the sub-hypergraphs are cut out of the whole graph, which is consumed or pruned by partitioning,
+    //so a compact copy is kept unless the compact graph partitioned on holds all edges
+    std::optional<part::CompactHypergraph> export_graph;
+    auto compact_holds_all_edges = out_of_core
+        || ((compact || parallel_runs || pack_components) && !topology && (pruned_percent == 0 || parallel_runs));
+    if(exporting && !compact_holds_all_edges) {
+        export_graph.emplace(graph, part::AdjacencyEncoding::Plain);
+    }
+
+    //keep the biggest edges away from the partitioning
+    part::Hypergraph::EdgeMap pruned_edges;
+    std::optional<part::RelabelledHypergraph> relabelled;
+    if(!streaming && !out_of_core) {
+        if(pruned_percent > 0 && !parallel_runs) {
+            pruned_edges = graph.extractBiggestEdges(pruned_percent);
+
+            if(!raw) {
+                std::cout << pruned_edges.size()
+                          << " hyperedges removed from the graph\n";
+            }
+        }
+
+        //with a topology, the graph of every part is made compact on its own
+        if((compact || parallel_runs || pack_components) && !topology) {
+            compact_graph.emplace(graph, encoding, order);
+
+            //free the hashmap based graph, only the compact one is needed
+            graph = part::Hypergraph{};
+
+            if(!raw) {
+                auto building_time =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin)
+                        .count();
+                std::cout << "compact adjacency built in "
+                          << building_time
+                          << " milliseconds, using "
+                          << compact_graph->memoryUsage() / (1024 * 1024)
+                          << " MiB\n";
+            }
+        } else if(order != part::VertexOrder::Input) {
+            auto vertex_order = part::computeVertexOrder(graph, order);
+            relabelled = part::relabelHypergraph(std::move(graph), vertex_order);
+
+            if(!raw) {
+                auto reordering_time =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin)
+                        .count();
+                std::cout << "graph reordered in "
+                          << reordering_time
+                          << " milliseconds\n";
+            }
+        }
+    }
+
+    phases.push_back(build_timer.stop());
+
+    if(auto_tune) {
+        part::PhaseTimer auto_timer{"auto", perf_counters};
+        part::ThreadPool pool{threads};
+
+        //the trials run on compact graphs, a temporary one if the graph is not compact anyway
+        std::optional<part::CompactHypergraph> tuning_graph;
+        if(!compact_graph) {
+            tuning_graph.emplace(relabelled ? relabelled->graph : graph, part::AdjacencyEncoding::Plain);
+        }
+        const auto& tuned_graph = compact_graph ? *compact_graph : *tuning_graph;
+
+        auto statistics = part::computeGraphStatistics(tuned_graph, pool);
+        auto tuned = part::tuneParameters(tuned_graph,
+                                          statistics,
+                                          part::AutoTuneSettings{partitions,
+                                                                 std::chrono::duration<double>{vm["auto-budget"].as<double>()},
+                                                                 numb_of_neigs_flag,
+                                                                 node_select_flag,
+                                                                 balance_on,
+                                                                 seed},
+                                          pool);
+
+        ssize = tuned.s_set_size;
+        numb_of_can = tuned.s_set_candidates;
+        percent = tuned.ignore_biggest_edges_in_percent;
+
+        //raw output stays plain csv
+        auto& log = raw ? std::cerr : std::cout;
+        log << (raw ? "" : "----------------------------------------------------------------------------\n")
+            << statistics
+            << tuned.trials << " trials on " << tuned.sample_fraction * 100 << "% of the edges chose:\n"
+            << "max secondary set size: " << ssize << "\n"
+            << "expansion candidates: " << numb_of_can << "\n"
+            << "ignored biggest edges: " << percent << "%\n"
+            << "k-1 on the sample: " << tuned.sample_k_minus_1 << "\n"
+            << "predicted partitioning time: " << tuned.predicted_seconds << " seconds\n";
+
+        phases.push_back(auto_timer.stop());
+    }
+
+    std::optional<part::ComponentPacking> packing;
+    if(pack_components) {
+        part::PhaseTimer components_timer{"components", perf_counters};
+        part::ThreadPool pool{threads};
+
+        auto components = part::findComponents(*compact_graph, pool);
+        packing = part::packSmallComponents(*compact_graph, components, partitions, balance_on);
+
+        if(!raw) {
+            std::cout << components.number_of_components
+                      << " connected components, "
+                      << packing->packed_components
+                      << " of them with "
+                      << packing->packed_vertices
+                      << " vertices assigned wholesale\n";
+        }
+
+        phases.push_back(components_timer.stop());
+    }
+
+    if(sweep) {
+        part::ThreadPool pool{threads};
+        const part::SweepSettings settings{numb_of_can,
+                                           percent,
+                                           numb_of_neigs_flag,
+                                           node_select_flag,
+                                           balance_on,
+                                           false};
+        auto results = part::runConfigurations(*compact_graph,
+                                               part::makeRunConfigurations(sweep_partitions,
+                                                                           sweep_sset_sizes,
+                                                                           sweep_seeds),
+                                               settings,
+                                               pool);
+
+        if(!raw) {
+            std::cout << "running " << results.size()
+                      << " configurations on " << pool.numberOfThreads() << " threads\n"
+                      << "----------------------------------------------------------------------------\n"
+                      << "partitions\tsset size\tseed\t\tsoed\t\tnode balancing\tedge balancing\tcut\t\tK-1\t\tmilliseconds\n";
+        }
+
+        //rows are printed in the order of the configurations
+        for(auto&& future : results) {
+            auto result = future.get();
+            std::cout << result.configuration.number_of_partitions
+                      << "\t\t"
+                      << result.configuration.s_set_size
+                      << "\t\t"
+                      << result.configuration.seed
+                      << "\t\t"
+                      << result.soed
+                      << "\t\t"
+                      << result.vertex_balancing
+                      << "\t\t"
+                      << result.edge_balancing
+                      << "\t\t"
+                      << result.hyperedge_cut
+                      << "\t\t"
+                      << result.k_minus_1
+                      << "\t\t"
+                      << static_cast<std::size_t>(result.milliseconds)
+                      << std::endl;
+        }
+
+        return 0;
+    }
+
+    part::PartitioningProgress progress;
+    std::optional<part::ProgressReporter> reporter;
+    if(progress_interval > 0) {
+        reporter.emplace(progress, std::chrono::duration<double>{progress_interval});
+    }
+
+    std::optional<part::CheckpointSettings> checkpoint;
+    if(checkpointing) {
+        //a checkpoint is only resumed on a graph built the same way
+        std::ostringstream layout;
+        if(out_of_core)
+            layout << "adjacency file";
+        else if(compact)
+            layout << encoding;
+        else
+            layout << "hashmap";
+
+        checkpoint.emplace(part::CheckpointSettings{vm["checkpoint"].as<std::string>(),
+                                                    std::chrono::duration<double>{vm["checkpoint-interval"].as<double>()},
+                                                    resume,
+                                                    part::GraphOrigin{part::inputFingerprint(input_path),
+                                                                      format,
+                                                                      layout.str(),
+                                                                      order,
+                                                                      pruned_percent}});
+    }
+
+    //a packing is only passed with the compact graph
+    auto partition = [&](auto&& graph_to_partition, auto... packed) {
+        return part::partitionGraph(std::forward<decltype(graph_to_partition)>(graph_to_partition),
+                                    partitions,
+                                    ssize,
+                                    numb_of_can,
+                                    percent,
+                                    numb_of_neigs_flag,
+                                    node_select_flag,
+                                    &partitioning_stats,
+                                    reporter ? &progress : nullptr,
+                                    checkpoint ? &*checkpoint : nullptr,
+                                    balance_on,
+                                    packed...);
+    };
+
+    std::optional<part::PortfolioSpread> spread;
+    std::uint32_t best_seed{seed};
+
+    if(streaming) {
+        //already partitioned while parsing
+    } else if(portfolio > 0) {
+        part::PhaseTimer portfolio_timer{"portfolio", perf_counters};
+        part::ThreadPool pool{threads};
+        const part::SweepSettings settings{numb_of_can,
+                                           percent,
+                                           numb_of_neigs_flag,
+                                           node_select_flag,
+                                           balance_on,
+                                           true};
+
+        std::vector<std::uint32_t> seeds(portfolio);
+        std::iota(std::begin(seeds), std::end(seeds), seed);
+
+        auto results = part::runConfigurations(*compact_graph,
+                                               part::makeRunConfigurations({partitions}, {ssize}, seeds),
+                                               settings,
+                                               pool);
+
+        spread.emplace();
+        auto best = part::selectBestRun(results, portfolio_metric, *spread);
+        parts = std::move(best.partitions);
+        best_seed = best.configuration.seed;
+
+        phases.push_back(portfolio_timer.stop());
+    } else if(topology) {
+        part::PhaseTimer topology_timer{"topology", perf_counters};
+        part::ThreadPool pool{threads};
+        const part::TopologySettings settings{ssize,
+                                              numb_of_can,
+                                              percent,
+                                              numb_of_neigs_flag,
+                                              node_select_flag,
+                                              balance_on,
+                                              encoding,
+                                              seed};
+
+        if(relabelled) {
+            parts = part::partitionTopology(relabelled->graph, *topology, settings, pool);
+            part::restoreOriginalIds(parts, relabelled->vertex_ids, relabelled->edge_ids);
+        } else {
+            parts = part::partitionTopology(graph, *topology, settings, pool);
+        }
+
+        phases.push_back(topology_timer.stop());
+    } else if(compact_graph) {
+        parts = partition(*compact_graph, packing ? &*packing : nullptr);
+    } else if(relabelled) {
+        parts = partition(std::move(relabelled->graph));
+        part::restoreOriginalIds(parts, relabelled->vertex_ids, relabelled->edge_ids);
+    } else {
+        parts = partition(std::move(graph));
+    }
+
+    reporter.reset();
+
+    if(!streaming && portfolio == 0 && !topology) {
+        phases.push_back(partitioning_stats.threshold);
+        phases.push_back(partitioning_stats.expansion);
+    }
+
+    part::restorePrunedEdges(parts, pruned_edges);
     end = std::chrono::steady_clock::now();
 
     auto partitioning_time =
         std::chrono::duration_cast<std::chrono::milliseconds>(end - begin)
             .count();
 
+    part::PhaseTimer metrics_timer{"metrics", perf_counters};
+
     //start parallel futures
     auto soed_fut = part::getSumOfExteralDegrees(parts);
     auto vtx_balance_fut = part::getVertexBalancing(parts);
     auto edge_balance_fut = part::getEdgeBalancing(parts);
     auto edge_cut_fut = part::getHyperedgeCut(parts);
     auto k_minus_1_fut = part::getKminus1Metric(parts, number_of_edges);
+    std::optional<std::future<std::size_t>> topology_cost_fut;
+    if(topology)
+        topology_cost_fut = part::getTopologyCost(parts, *topology, link_costs);
 
     //wait for all results
     auto soed = soed_fut.get();
@@ -173,6 +873,10 @@ auto main(int argc, char const* argv[])
     auto edge_balance = edge_balance_fut.get();
     auto edge_cut = edge_cut_fut.get();
     auto k_minus_1 = k_minus_1_fut.get();
+    auto topology_cost = topology_cost_fut ? topology_cost_fut->get() : 0;
+
+    phases.push_back(metrics_timer.stop());
+    part::PhaseTimer output_timer{"output", perf_counters};
 
     if(raw) {
         std::cout << partitions
@@ -187,8 +891,25 @@ auto main(int argc, char const* argv[])
                   << "\t\t"
                   << k_minus_1
                   << "\t\t"
-                  << (parsing_time + partitioning_time)
-                  << std::endl;
+                  << (parsing_time + partitioning_time);
+
+        if(topology)
+            std::cout << "\t\t" << topology_cost;
+
+        //seed of the best run and the distribution of the portfolio metric
+        if(spread) {
+            std::cout << "\t\t"
+                      << best_seed
+                      << "\t\t"
+                      << spread->min
+                      << "\t\t"
+                      << spread->mean
+                      << "\t\t"
+                      << spread->max
+                      << "\t\t"
+                      << spread->standard_deviation;
+        }
+        std::cout << std::endl;
 
     } else {
         std::cout << "partitioning done in "
@@ -204,6 +925,29 @@ auto main(int argc, char const* argv[])
                   << "partition time: " << partitioning_time << "\n"
                   << "total time: " << (parsing_time + partitioning_time)
                   << std::endl;
+
+        if(topology) {
+            std::cout << "topology cost: " << topology_cost << std::endl;
+        }
+
+        //same measure as the node balancing, on what the partitions were balanced on
+        auto&& loads = partitioning_stats.partition_loads;
+        if(balance_on != part::BalanceMode::Vertices && !loads.empty()) {
+            auto [smallest, biggest] = std::minmax_element(std::begin(loads), std::end(loads));
+            std::cout << balance_on << " balancing: "
+                      << (*biggest - *smallest) / static_cast<double>(*biggest)
+                      << std::endl;
+        }
+
+        if(spread) {
+            std::cout << "----------------------------------------------------------------------------\n"
+                      << "best of " << portfolio << " runs with seed " << best_seed << "\n"
+                      << portfolio_metric << " min: " << spread->min << "\n"
+                      << portfolio_metric << " mean: " << spread->mean << "\n"
+                      << portfolio_metric << " max: " << spread->max << "\n"
+                      << portfolio_metric << " standard deviation: " << spread->standard_deviation
+                      << std::endl;
+        }
     }
 
     if(output) {
@@ -224,5 +968,78 @@ auto main(int argc, char const* argv[])
             << "done\n";
     }
 
+    if(exporting) {
+        auto directory = vm["export-partitions"].as<std::string>();
+        if(!raw) {
+            std::cout << "----------------------------------------------------------------------------\n"
+                      << "exporting partitions into " << directory << " ...\n";
+        }
+
+        part::ThreadPool pool{threads};
+        part::exportPartitions(export_graph ? *export_graph : *compact_graph, parts, directory, pool);
+    }
+
+    phases.push_back(output_timer.stop());
+
+    if(perf_counters && !raw) {
+        std::cout << "----------------------------------------------------------------------------\n"
+                  << "phase\t\tcycles\t\tinstructions\tllc misses\tbranch misses\n";
+
+        auto print = [](const auto& count) {
+            if(count)
+                std::cout << count.value();
+            else
+                std::cout << "-";
+            std::cout << "\t\t";
+        };
+
+        for(auto&& phase : phases) {
+            std::cout << phase.name << "\t\t";
+            print(phase.counters->cycles);
+            print(phase.counters->instructions);
+            print(phase.counters->llc_misses);
+            print(phase.counters->branch_misses);
+            std::cout << "\n";
+        }
+    }
+
+    if(vm.count("stats-json")) {
+        auto stats_path = vm["stats-json"].as<std::string>();
+        std::ofstream stats_file{stats_path};
+        if(!stats_file) {
+            std::cout << "file: " << stats_path << " could not be opened\n";
+            std::exit(-1);
+        }
+
+        part::JsonWriter json{stats_file};
+        json.beginObject()
+            .key("graph")
+            .beginObject()
+            .key("input").value(input_path)
+            .key("vertices").value(number_of_nodes)
+            .key("edges").value(number_of_edges)
+            .key("pruned_edges").value(pruned_edges.size())
+            .key("compact_bytes").value(compact_graph ? compact_graph->memoryUsage() : 0)
+            .endObject();
+
+        json.key("phases").beginArray();
+        for(auto&& phase : phases) {
+            part::writePhase(json, phase);
+        }
+        json.endArray();
+
+        json.key("expansion")
+            .beginObject()
+            .key("sset_hits").value(partitioning_stats.sset_hits)
+            .key("seed_fallbacks").value(partitioning_stats.seed_fallbacks)
+            .key("sset_candidates").value(partitioning_stats.sset_candidates)
+            .key("packed_vertices").value(partitioning_stats.packed_vertices)
+            .endObject();
+
+        json.key("peak_rss_bytes").value(part::peakRssBytes())
+            .endObject();
+        stats_file << "\n";
+    }
+
     return 0;
 }
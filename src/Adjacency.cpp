@@ -0,0 +1,148 @@
+#include <Adjacency.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+
+
+auto part::operator>>(std::istream& in, part::AdjacencyEncoding& encoding)
+    -> std::istream&
+{
+    std::string token;
+    in >> token;
+    if(token == "csr")
+        encoding = part::AdjacencyEncoding::Plain;
+    else if(token == "varint")
+        encoding = part::AdjacencyEncoding::DeltaVarint;
+    else
+        in.setstate(std::ios_base::failbit);
+    return in;
+}
+
+auto part::operator<<(std::ostream& os, const part::AdjacencyEncoding& encoding)
+    -> std::ostream&
+{
+    switch(encoding) {
+    case part::AdjacencyEncoding::Plain:
+        os << "csr";
+        break;
+    case part::AdjacencyEncoding::DeltaVarint:
+        os << "varint";
+        break;
+    default:
+        os.setstate(std::ios_base::failbit);
+        break;
+    }
+
+    return os;
+}
+
+auto part::encodeVarint(std::uint64_t value,
+                        std::vector<std::uint8_t>& out)
+    -> void
+{
+    while(value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+auto part::encodeList(AdjacencyEncoding encoding,
+                      const std::vector<std::uint64_t>& ids,
+                      std::vector<std::uint8_t>& out)
+    -> void
+{
+    if(encoding == AdjacencyEncoding::Plain) {
+        for(auto&& id : ids) {
+            if(id > std::numeric_limits<std::uint32_t>::max()) {
+                std::cout << "id " << id << " does not fit into a 32bit csr adjacency, use varint instead\n";
+                std::exit(-1);
+            }
+
+            auto narrow = static_cast<std::uint32_t>(id);
+            auto old_size = out.size();
+            out.resize(old_size + sizeof(narrow));
+            std::memcpy(out.data() + old_size, &narrow, sizeof(narrow));
+        }
+        return;
+    }
+
+    //the length first, then the differences to the previous id
+    encodeVarint(ids.size(), out);
+
+    std::uint64_t last{0};
+    for(auto&& id : ids) {
+        encodeVarint(id - last, out);
+        last = id;
+    }
+}
+
+part::Adjacency::Adjacency(AdjacencyEncoding encoding)
+    : _encoding(encoding)
+{
+    _offsets = _owned_offsets.data();
+}
+
+part::Adjacency::Adjacency(AdjacencyEncoding encoding,
+                           std::size_t size,
+                           const std::uint64_t* offsets,
+                           const std::uint8_t* data,
+                           std::size_t offset_unit)
+    : _encoding(encoding),
+      _size(size),
+      _offsets(offsets),
+      _data(data),
+      _offset_unit(offset_unit) {}
+
+auto part::Adjacency::addList(std::vector<std::uint64_t> ids)
+    -> void
+{
+    std::sort(std::begin(ids), std::end(ids));
+
+    encodeList(_encoding, ids, _owned_data);
+
+    _owned_offsets.push_back(_owned_data.size());
+
+    //the vectors might have been reallocated
+    _offsets = _owned_offsets.data();
+    _data = _owned_data.data();
+    ++_size;
+}
+
+auto part::Adjacency::size() const
+    -> std::size_t
+{
+    return _size;
+}
+
+auto part::Adjacency::sizeOf(std::size_t list) const
+    -> std::size_t
+{
+    if(_encoding == AdjacencyEncoding::Plain) {
+        return (_offsets[list + 1] - _offsets[list]) * _offset_unit / sizeof(std::uint32_t);
+    }
+
+    const auto* begin = _data + _offsets[list] * _offset_unit;
+    return decodeVarint(begin);
+}
+
+auto part::Adjacency::prefetch(std::size_t list) const
+    -> void
+{
+    __builtin_prefetch(_data + _offsets[list] * _offset_unit);
+}
+
+auto part::Adjacency::memoryUsage() const
+    -> std::size_t
+{
+    return _owned_offsets.capacity() * sizeof(std::uint64_t)
+        + _owned_data.capacity();
+}
+
+auto part::Adjacency::getEncoding() const
+    -> AdjacencyEncoding
+{
+    return _encoding;
+}
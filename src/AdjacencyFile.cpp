@@ -0,0 +1,399 @@
+#include <AdjacencyFile.hpp>
+#include <MappedFile.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+
+namespace {
+
+// file layout, every section starts 8 byte aligned:
+// header | vertex ids | edge ids | vertex weights, if the input has them
+//        | vertex offsets | vertex lists | edge offsets | edge lists
+constexpr std::array<char, 8> file_magic{'H', 'Y', 'P', 'E', 'A', 'D', 'J', '3'};
+//files of the first version have no vertex weights,
+//files of the second one do not know their input
+constexpr std::array<std::array<char, 8>, 2> older_file_magics{{{'H', 'Y', 'P', 'E', 'A', 'D', 'J', '1'},
+                                                                {'H', 'Y', 'P', 'E', 'A', 'D', 'J', '2'}}};
+
+struct FileHeader
+{
+    std::array<char, 8> magic;
+    std::uint64_t encoding;
+    std::uint64_t number_of_vertices;
+    std::uint64_t number_of_edges;
+    std::uint64_t vertex_list_bytes;
+    std::uint64_t edge_list_bytes;
+    std::uint64_t has_vertex_weights;
+    std::uint64_t input_fingerprint;
+    std::uint64_t format;
+};
+
+//the header of @param file_path, nullopt if it is too short to hold one
+auto readHeader(const std::string& file_path)
+    -> std::optional<FileHeader>
+{
+    std::ifstream in{file_path, std::ios::binary};
+    FileHeader header;
+    if(!in.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        return std::nullopt;
+    return header;
+}
+
+auto aligned(std::size_t bytes)
+    -> std::size_t
+{
+    return (bytes + 7) / 8 * 8;
+}
+
+//numbers the parsed vertices and edges densely in the order
+//they appear and streams the pins into a temporary file
+class PinWriter : public part::PinSink
+{
+public:
+    PinWriter(const std::string& pin_path)
+        : _pins(pin_path, std::ios::binary) {}
+
+    auto addEdgeList(const int64_t& vtx,
+                     const std::vector<int64_t>& edge_list)
+        -> void override
+    {
+        auto dense_vtx = vertexId(vtx);
+        for(auto&& edge : edge_list) {
+            writePin(dense_vtx, edgeId(edge));
+        }
+    }
+
+    auto addVertex(int64_t vtx)
+        -> void override
+    {
+        vertexId(vtx);
+    }
+
+    auto addNodeList(const int64_t& edge,
+                     const std::vector<int64_t>& node_list)
+        -> void override
+    {
+        auto dense_edge = edgeId(edge);
+        for(auto&& vtx : node_list) {
+            writePin(vertexId(vtx), dense_edge);
+        }
+    }
+
+    auto connect(const int64_t& vtx,
+                 const int64_t& edge)
+        -> void override
+    {
+        writePin(vertexId(vtx), edgeId(edge));
+    }
+
+    //weights of vertices without pins are ignored, like Hypergraph does
+    auto setVertexWeight(int64_t vtx,
+                         std::uint64_t weight)
+        -> void override
+    {
+        auto iter = _vertex_to_dense.find(vtx);
+        if(iter == std::end(_vertex_to_dense))
+            return;
+
+        if(vertex_weights.size() <= iter->second)
+            vertex_weights.resize(vertex_ids.size(), 1);
+        vertex_weights[iter->second] = weight;
+    }
+
+    auto finish()
+        -> void
+    {
+        _pins.close();
+
+        //vertices without a weight weigh 1
+        if(!vertex_weights.empty())
+            vertex_weights.resize(vertex_ids.size(), 1);
+    }
+
+    std::vector<int64_t> vertex_ids;
+    std::vector<int64_t> edge_ids;
+    std::vector<std::uint64_t> vertex_weights; //empty if the input has no vertex weights
+    std::vector<std::uint64_t> degrees;
+    std::vector<std::uint64_t> sizes;
+    std::uint64_t number_of_pins{0};
+
+private:
+    auto vertexId(int64_t vtx)
+        -> std::uint64_t
+    {
+        auto [iter, inserted] = _vertex_to_dense.insert({vtx, vertex_ids.size()});
+        if(inserted) {
+            vertex_ids.push_back(vtx);
+            degrees.push_back(0);
+        }
+        return iter->second;
+    }
+
+    auto edgeId(int64_t edge)
+        -> std::uint64_t
+    {
+        auto [iter, inserted] = _edge_to_dense.insert({edge, edge_ids.size()});
+        if(inserted) {
+            edge_ids.push_back(edge);
+            sizes.push_back(0);
+        }
+        return iter->second;
+    }
+
+    auto writePin(std::uint64_t vtx, std::uint64_t edge)
+        -> void
+    {
+        std::array<std::uint64_t, 2> pin{vtx, edge};
+        _pins.write(reinterpret_cast<const char*>(pin.data()), sizeof(pin));
+        ++degrees[vtx];
+        ++sizes[edge];
+        ++number_of_pins;
+    }
+
+    std::unordered_map<int64_t, std::uint64_t> _vertex_to_dense;
+    std::unordered_map<int64_t, std::uint64_t> _edge_to_dense;
+    std::ofstream _pins;
+};
+
+//turns list sizes into the start of every list
+auto prefixSums(const std::vector<std::uint64_t>& sizes,
+                std::uint64_t first)
+    -> std::vector<std::uint64_t>
+{
+    std::vector<std::uint64_t> starts{first};
+    starts.reserve(sizes.size() + 1);
+    for(auto&& size : sizes) {
+        starts.push_back(starts.back() + size);
+    }
+    return starts;
+}
+
+//writes the lists stored unsorted in @param scatter at the given starts
+//sorted, deduplicated and encoded into @param out
+//returns the number of bytes used by the encoded lists
+auto writeLists(std::ofstream& out,
+                const std::uint64_t* scatter,
+                const std::vector<std::uint64_t>& starts,
+                part::AdjacencyEncoding encoding)
+    -> std::size_t
+{
+    const auto number_of_lists = starts.size() - 1;
+
+    //the offsets are only known after encoding the lists,
+    //so reserve their space now and write them at the end
+    const auto offset_position = out.tellp();
+    std::vector<std::uint64_t> offsets(number_of_lists + 1, 0);
+    out.write(reinterpret_cast<const char*>(offsets.data()),
+              offsets.size() * sizeof(std::uint64_t));
+
+    std::vector<std::uint64_t> list;
+    std::vector<std::uint8_t> buffer;
+    std::size_t written{0};
+    for(std::size_t i{0}; i < number_of_lists; ++i) {
+        list.assign(scatter + starts[i], scatter + starts[i + 1]);
+        std::sort(std::begin(list), std::end(list));
+        list.erase(std::unique(std::begin(list), std::end(list)),
+                   std::end(list));
+
+        part::encodeList(encoding, list, buffer);
+        offsets[i + 1] = written + buffer.size();
+
+        if(buffer.size() > (1 << 20)) {
+            out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+            written += buffer.size();
+            buffer.clear();
+        }
+    }
+    out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    written += buffer.size();
+
+    //pad to keep the next section aligned
+    std::array<char, 8> padding{};
+    out.write(padding.data(), aligned(written) - written);
+
+    const auto end_position = out.tellp();
+    out.seekp(offset_position);
+    out.write(reinterpret_cast<const char*>(offsets.data()),
+              offsets.size() * sizeof(std::uint64_t));
+    out.seekp(end_position);
+
+    return written;
+}
+
+} // namespace
+
+auto part::buildAdjacencyFile(const std::string& input_path,
+                              ParsingMode mode,
+                              const std::string& file_path,
+                              AdjacencyEncoding encoding)
+    -> void
+{
+    //taken before parsing, so a change of the input meanwhile is noticed by the next run
+    const auto input_fingerprint = inputFingerprint(input_path);
+
+    const auto pin_path = file_path + ".pins.tmp";
+    const auto scatter_path = file_path + ".scatter.tmp";
+
+    //first pass: parse the input and stream the pins to disk
+    PinWriter writer{pin_path};
+    parseFileIntoSink(input_path, mode, writer);
+    writer.finish();
+
+    const auto vertex_starts = prefixSums(writer.degrees, 0);
+    const auto edge_starts = prefixSums(writer.sizes, writer.number_of_pins);
+
+    //second pass: scatter the pins into the lists of both directions
+    {
+        MappedFile scatter_file{scatter_path,
+                                2 * writer.number_of_pins * sizeof(std::uint64_t)};
+        auto* scatter = reinterpret_cast<std::uint64_t*>(scatter_file.data());
+
+        auto vertex_cursors = vertex_starts;
+        auto edge_cursors = edge_starts;
+
+        std::ifstream pins{pin_path, std::ios::binary};
+        std::vector<std::array<std::uint64_t, 2>> chunk(1 << 16);
+        while(pins.read(reinterpret_cast<char*>(chunk.data()),
+                        chunk.size() * sizeof(chunk[0]))
+              || pins.gcount() > 0) {
+            const auto read = pins.gcount() / sizeof(chunk[0]);
+            for(std::size_t i{0}; i < read; ++i) {
+                auto [vtx, edge] = chunk[i];
+                scatter[vertex_cursors[vtx]++] = edge;
+                scatter[edge_cursors[edge]++] = vtx;
+            }
+        }
+    }
+    std::remove(pin_path.c_str());
+
+    //third pass: sort and encode every list into the adjacency file
+    {
+        MappedFile scatter_file{scatter_path};
+        const auto* scatter = reinterpret_cast<const std::uint64_t*>(scatter_file.data());
+
+        std::ofstream out{file_path, std::ios::binary};
+        if(!out) {
+            std::cout << "file: " << file_path << " could not be created\n";
+            std::exit(-1);
+        }
+
+        FileHeader header{file_magic,
+                          static_cast<std::uint64_t>(encoding),
+                          writer.vertex_ids.size(),
+                          writer.edge_ids.size(),
+                          0,
+                          0,
+                          !writer.vertex_weights.empty(),
+                          input_fingerprint,
+                          static_cast<std::uint64_t>(mode)};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(writer.vertex_ids.data()),
+                  writer.vertex_ids.size() * sizeof(int64_t));
+        out.write(reinterpret_cast<const char*>(writer.edge_ids.data()),
+                  writer.edge_ids.size() * sizeof(int64_t));
+        out.write(reinterpret_cast<const char*>(writer.vertex_weights.data()),
+                  writer.vertex_weights.size() * sizeof(std::uint64_t));
+
+        header.vertex_list_bytes = writeLists(out, scatter, vertex_starts, encoding);
+        header.edge_list_bytes = writeLists(out, scatter, edge_starts, encoding);
+
+        out.seekp(0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    std::remove(scatter_path.c_str());
+}
+
+auto part::readAdjacencyFileSource(const std::string& file_path)
+    -> std::optional<AdjacencyFileSource>
+{
+    const auto header = readHeader(file_path);
+    if(!header || header->magic != file_magic)
+        return std::nullopt;
+
+    return AdjacencyFileSource{header->input_fingerprint,
+                               static_cast<ParsingMode>(header->format),
+                               static_cast<AdjacencyEncoding>(header->encoding)};
+}
+
+auto part::mapAdjacencyFile(const std::string& file_path)
+    -> CompactHypergraph
+{
+    auto file = std::make_shared<const MappedFile>(file_path);
+
+    FileHeader header;
+    if(file->size() < sizeof(header)) {
+        std::cout << "file: " << file_path << " is not an adjacency file\n";
+        std::exit(-1);
+    }
+    std::memcpy(&header, file->data(), sizeof(header));
+    if(std::find(std::begin(older_file_magics), std::end(older_file_magics), header.magic)
+       != std::end(older_file_magics)) {
+        std::cout << "file: " << file_path << " was written by an older version, delete it to build it again\n";
+        std::exit(-1);
+    }
+    if(header.magic != file_magic) {
+        std::cout << "file: " << file_path << " is not an adjacency file\n";
+        std::exit(-1);
+    }
+
+    //the neighbourhood expansion jumps around in the lists
+    file->adviseRandomAccess();
+
+    const auto encoding = static_cast<AdjacencyEncoding>(header.encoding);
+    const auto* position = file->data() + sizeof(header);
+    auto remaining = file->size() - sizeof(header);
+
+    //start of the next section of @param count entries of @param entry_size bytes,
+    //exits if the file ends before the section does
+    auto section = [&](std::uint64_t count, std::uint64_t entry_size) {
+        if(count > remaining / entry_size) {
+            std::cout << "file: " << file_path << " is truncated\n";
+            std::exit(-1);
+        }
+        const auto* start = position;
+        const auto bytes = std::min<std::uint64_t>(aligned(count * entry_size), remaining);
+        position += bytes;
+        remaining -= bytes;
+        return start;
+    };
+
+    const auto* vertex_ids = reinterpret_cast<const int64_t*>(section(header.number_of_vertices, sizeof(int64_t)));
+    const auto* edge_ids = reinterpret_cast<const int64_t*>(section(header.number_of_edges, sizeof(int64_t)));
+    const auto* vertex_weights = header.has_vertex_weights
+        ? reinterpret_cast<const std::uint64_t*>(section(header.number_of_vertices, sizeof(std::uint64_t)))
+        : nullptr;
+
+    const auto* vertex_offsets = reinterpret_cast<const std::uint64_t*>(section(header.number_of_vertices + 1, sizeof(std::uint64_t)));
+    const auto* vertex_lists = section(header.vertex_list_bytes, 1);
+    const auto* edge_offsets = reinterpret_cast<const std::uint64_t*>(section(header.number_of_edges + 1, sizeof(std::uint64_t)));
+    const auto* edge_lists = section(header.edge_list_bytes, 1);
+
+    //the lists are only read within the bytes the offsets end at
+    if(vertex_offsets[0] != 0
+       || vertex_offsets[header.number_of_vertices] != header.vertex_list_bytes
+       || edge_offsets[0] != 0
+       || edge_offsets[header.number_of_edges] != header.edge_list_bytes) {
+        std::cout << "file: " << file_path << " is corrupt\n";
+        std::exit(-1);
+    }
+
+    return CompactHypergraph{Adjacency{encoding,
+                                       header.number_of_vertices,
+                                       vertex_offsets,
+                                       vertex_lists},
+                             Adjacency{encoding,
+                                       header.number_of_edges,
+                                       edge_offsets,
+                                       edge_lists},
+                             vertex_ids,
+                             edge_ids,
+                             std::move(file),
+                             vertex_weights};
+}
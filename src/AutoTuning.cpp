@@ -0,0 +1,210 @@
+#include <AutoTuning.hpp>
+#include <Sweep.hpp>
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <random>
+
+
+namespace {
+
+//number of pins the sample of the trials has at most, about
+constexpr std::size_t sample_pins{1 << 20};
+
+//parameters tried on the sample
+const std::vector<std::size_t> trial_s_set_sizes{5, 10, 20, 40};
+const std::vector<std::size_t> trial_s_set_candidates{2, 4};
+const std::vector<double> trial_ignore_percents{0, 1, 5};
+
+//how many vertices or edges have a degree or size
+using Histogram = std::map<std::size_t, std::size_t>;
+
+auto mergeHistograms(const std::vector<Histogram>& histograms)
+    -> Histogram
+{
+    Histogram merged;
+    for(auto&& histogram : histograms) {
+        for(auto&& [value, count] : histogram) {
+            merged[value] += count;
+        }
+    }
+    return merged;
+}
+
+//smallest value which at least @param fraction of all counted values do not exceed
+auto percentileOf(const Histogram& histogram,
+                  std::size_t total,
+                  double fraction)
+    -> std::size_t
+{
+    std::size_t seen{0};
+    for(auto&& [value, count] : histogram) {
+        seen += count;
+        if(seen >= fraction * total)
+            return value;
+    }
+    return histogram.empty() ? 0 : histogram.rbegin()->first;
+}
+
+//a random part of the edges of @param graph with all their vertices,
+//in the dense ids of the graph
+auto sampleEdges(const part::CompactHypergraph& graph,
+                 double fraction,
+                 std::uint32_t seed)
+    -> part::Hypergraph
+{
+    std::mt19937 engine{seed};
+    std::bernoulli_distribution take{fraction};
+
+    part::Hypergraph sample;
+    for(std::uint64_t edge{0}; edge < graph.numberOfEdges(); ++edge) {
+        if(!take(engine))
+            continue;
+
+        graph.forEachVertexOf(edge, [&](auto vtx) {
+            sample.connect(vtx, edge);
+            if(graph.weightOf(vtx) != 1)
+                sample.setVertexWeight(vtx, graph.weightOf(vtx));
+        });
+    }
+    return sample;
+}
+
+} // namespace
+
+auto part::computeGraphStatistics(const CompactHypergraph& graph,
+                                  ThreadPool& pool)
+    -> GraphStatistics
+{
+    auto degrees = mergeHistograms(forEachRange(graph.numberOfVertices(), pool, [&graph](auto begin, auto end) {
+        Histogram histogram;
+        for(auto vtx = begin; vtx < end; ++vtx) {
+            histogram[graph.degreeOf(vtx)]++;
+        }
+        return histogram;
+    }));
+
+    auto sizes = mergeHistograms(forEachRange(graph.numberOfEdges(), pool, [&graph](auto begin, auto end) {
+        Histogram histogram;
+        for(auto edge = begin; edge < end; ++edge) {
+            histogram[graph.sizeOf(edge)]++;
+        }
+        return histogram;
+    }));
+
+    GraphStatistics statistics;
+    statistics.vertices = graph.numberOfVertices();
+    statistics.edges = graph.numberOfEdges();
+    for(auto&& [size, count] : sizes) {
+        statistics.pins += size * count;
+    }
+
+    if(statistics.vertices > 0) {
+        statistics.mean_degree = static_cast<double>(statistics.pins) / statistics.vertices;
+        statistics.median_degree = percentileOf(degrees, statistics.vertices, 0.5);
+        statistics.max_degree = degrees.rbegin()->first;
+    }
+
+    if(statistics.edges > 0) {
+        statistics.mean_edge_size = static_cast<double>(statistics.pins) / statistics.edges;
+        statistics.median_edge_size = percentileOf(sizes, statistics.edges, 0.5);
+        statistics.p99_edge_size = percentileOf(sizes, statistics.edges, 0.99);
+        statistics.max_edge_size = sizes.rbegin()->first;
+    }
+
+    return statistics;
+}
+
+auto part::operator<<(std::ostream& os, const GraphStatistics& statistics)
+    -> std::ostream&
+{
+    return os << "vertex degrees: mean " << statistics.mean_degree
+              << ", median " << statistics.median_degree
+              << ", max " << statistics.max_degree << "\n"
+              << "edge sizes: mean " << statistics.mean_edge_size
+              << ", median " << statistics.median_edge_size
+              << ", 99th percentile " << statistics.p99_edge_size
+              << ", max " << statistics.max_edge_size << "\n";
+}
+
+auto part::tuneParameters(const CompactHypergraph& graph,
+                          const GraphStatistics& statistics,
+                          const AutoTuneSettings& settings,
+                          ThreadPool& pool)
+    -> TunedParameters
+{
+    //the defaults, nothing to try on a graph without edges
+    TunedParameters tuned{10, 2, 0, 1, 0, 0, 0};
+    if(statistics.pins == 0)
+        return tuned;
+
+    tuned.sample_fraction = std::min(1.0, static_cast<double>(sample_pins) / statistics.pins);
+    const CompactHypergraph sample{sampleEdges(graph, tuned.sample_fraction, settings.seed),
+                                   graph.getEncoding()};
+
+    std::size_t pins_of_sample{0};
+    for(std::uint64_t edge{0}; edge < sample.numberOfEdges(); ++edge) {
+        pins_of_sample += sample.sizeOf(edge);
+    }
+    const auto scale = static_cast<double>(statistics.pins) / std::max<std::size_t>(pins_of_sample, 1);
+
+    //ignoring the biggest edges only pays off if there are a few very big ones
+    std::vector<double> percents{0};
+    if(statistics.max_edge_size > 8 * statistics.p99_edge_size) {
+        percents = trial_ignore_percents;
+    }
+
+    //all trials are submitted before the first is waited for
+    struct Trial
+    {
+        std::size_t s_set_candidates;
+        double ignore_biggest_edges_in_percent;
+        std::vector<std::future<RunResult>> results;
+    };
+    std::vector<Trial> trials;
+    for(auto&& candidates : trial_s_set_candidates) {
+        for(auto&& percent : percents) {
+            const SweepSettings sweep_settings{candidates,
+                                               percent,
+                                               settings.num_neigs_flag,
+                                               settings.node_select_flag,
+                                               settings.balance_on,
+                                               false};
+            trials.push_back(Trial{candidates,
+                                   percent,
+                                   runConfigurations(sample,
+                                                     makeRunConfigurations({settings.number_of_partitions},
+                                                                           trial_s_set_sizes,
+                                                                           {settings.seed}),
+                                                     sweep_settings,
+                                                     pool)});
+        }
+    }
+
+    //collected in order, so the choice does not depend on which trial finishes first
+    std::optional<bool> best_fits;
+    for(auto&& trial : trials) {
+        for(auto&& future : trial.results) {
+            auto result = future.get();
+            const auto predicted = result.milliseconds / 1000 * scale;
+            const auto fits = predicted <= settings.time_budget.count();
+            tuned.trials++;
+
+            auto better = !best_fits
+                || (fits && !*best_fits)
+                || (fits && result.k_minus_1 < tuned.sample_k_minus_1)
+                || (!fits && !*best_fits && predicted < tuned.predicted_seconds);
+
+            if(better) {
+                best_fits = fits;
+                tuned.s_set_size = result.configuration.s_set_size;
+                tuned.s_set_candidates = trial.s_set_candidates;
+                tuned.ignore_biggest_edges_in_percent = trial.ignore_biggest_edges_in_percent;
+                tuned.sample_k_minus_1 = result.k_minus_1;
+                tuned.predicted_seconds = predicted;
+            }
+        }
+    }
+
+    return tuned;
+}
@@ -0,0 +1,138 @@
+#include <BinaryStream.hpp>
+#include <Checkpoint.hpp>
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+
+namespace {
+
+//file layout: magic | parameters | counters | partition sizes | assigned vertices
+//             | graph state | secondary set state
+//the parameters are written field by field, so the file holds no padding
+constexpr std::array<char, 8> checkpoint_magic{'H', 'Y', 'P', 'E', 'C', 'K', 'P', '3'};
+//the first version stored the secondary set in its bucket order,
+//the second one did not store how the graph was built
+constexpr std::array<std::array<char, 8>, 2> older_checkpoint_magics{{{'H', 'Y', 'P', 'E', 'C', 'K', 'P', '1'},
+                                                                      {'H', 'Y', 'P', 'E', 'C', 'K', 'P', '2'}}};
+
+auto writeParameters(std::ostream& out,
+                     const part::CheckpointParameters& parameters)
+    -> void
+{
+    part::writeValue(out, parameters.number_of_vertices);
+    part::writeValue(out, parameters.number_of_partitions);
+    part::writeValue(out, parameters.s_set_size);
+    part::writeValue(out, parameters.s_set_candidates);
+    part::writeValue(out, parameters.ignore_biggest_edges_in_percent);
+    part::writeValue<std::uint8_t>(out, static_cast<std::uint8_t>(parameters.num_neigs_flag));
+    part::writeValue<std::uint8_t>(out, static_cast<std::uint8_t>(parameters.node_select_flag));
+    part::writeValue<std::uint8_t>(out, static_cast<std::uint8_t>(parameters.balance_on));
+
+    const auto& origin = parameters.origin;
+    part::writeValue(out, origin.input_fingerprint);
+    part::writeValue<std::uint8_t>(out, static_cast<std::uint8_t>(origin.format));
+    part::writeValues(out, std::vector<char>{std::begin(origin.layout), std::end(origin.layout)});
+    part::writeValue<std::uint8_t>(out, static_cast<std::uint8_t>(origin.vertex_order));
+    part::writeValue(out, origin.pruned_percent);
+}
+
+auto readParameters(std::istream& in)
+    -> part::CheckpointParameters
+{
+    part::CheckpointParameters parameters;
+    parameters.number_of_vertices = part::readValue<std::uint64_t>(in);
+    parameters.number_of_partitions = part::readValue<std::uint64_t>(in);
+    parameters.s_set_size = part::readValue<std::uint64_t>(in);
+    parameters.s_set_candidates = part::readValue<std::uint64_t>(in);
+    parameters.ignore_biggest_edges_in_percent = part::readValue<double>(in);
+    parameters.num_neigs_flag = static_cast<part::NodeHeuristicMode>(part::readValue<std::uint8_t>(in));
+    parameters.node_select_flag = static_cast<part::NodeSelectionMode>(part::readValue<std::uint8_t>(in));
+    parameters.balance_on = static_cast<part::BalanceMode>(part::readValue<std::uint8_t>(in));
+
+    auto& origin = parameters.origin;
+    origin.input_fingerprint = part::readValue<std::uint64_t>(in);
+    origin.format = static_cast<part::ParsingMode>(part::readValue<std::uint8_t>(in));
+    const auto layout = part::readValues<char>(in);
+    origin.layout.assign(std::begin(layout), std::end(layout));
+    origin.vertex_order = static_cast<part::VertexOrder>(part::readValue<std::uint8_t>(in));
+    origin.pruned_percent = part::readValue<double>(in);
+    return parameters;
+}
+
+} // namespace
+
+auto part::operator==(const GraphOrigin& lhs, const GraphOrigin& rhs)
+    -> bool
+{
+    return lhs.input_fingerprint == rhs.input_fingerprint
+        && lhs.format == rhs.format
+        && lhs.layout == rhs.layout
+        && lhs.vertex_order == rhs.vertex_order
+        && lhs.pruned_percent == rhs.pruned_percent;
+}
+
+auto part::operator==(const CheckpointParameters& lhs, const CheckpointParameters& rhs)
+    -> bool
+{
+    return lhs.number_of_vertices == rhs.number_of_vertices
+        && lhs.number_of_partitions == rhs.number_of_partitions
+        && lhs.s_set_size == rhs.s_set_size
+        && lhs.s_set_candidates == rhs.s_set_candidates
+        && lhs.ignore_biggest_edges_in_percent == rhs.ignore_biggest_edges_in_percent
+        && lhs.num_neigs_flag == rhs.num_neigs_flag
+        && lhs.node_select_flag == rhs.node_select_flag
+        && lhs.balance_on == rhs.balance_on
+        && lhs.origin == rhs.origin;
+}
+
+auto part::writeCheckpoint(std::ostream& out,
+                           const PartitioningCheckpoint& checkpoint)
+    -> void
+{
+    writeValue(out, checkpoint_magic);
+    writeParameters(out, checkpoint.parameters);
+    writeValue(out, checkpoint.max_edge_size);
+    writeValue(out, checkpoint.sset_hits);
+    writeValue(out, checkpoint.seed_fallbacks);
+    writeValue(out, checkpoint.sset_candidates);
+    writeValues(out, checkpoint.partition_sizes);
+    writeValues(out, checkpoint.assigned_vertices);
+}
+
+auto part::readCheckpoint(std::istream& in,
+                          const std::string& path)
+    -> PartitioningCheckpoint
+{
+    const auto magic = readValue<std::array<char, 8>>(in);
+    if(std::find(std::begin(older_checkpoint_magics), std::end(older_checkpoint_magics), magic)
+       != std::end(older_checkpoint_magics)) {
+        std::cout << "file: " << path << " was written by an older version, delete it to start over\n";
+        std::exit(-1);
+    }
+    if(magic != checkpoint_magic) {
+        std::cout << "file: " << path << " is not a checkpoint\n";
+        std::exit(-1);
+    }
+
+    PartitioningCheckpoint checkpoint;
+    checkpoint.parameters = readParameters(in);
+    checkpoint.max_edge_size = readValue<std::uint64_t>(in);
+    checkpoint.sset_hits = readValue<std::uint64_t>(in);
+    checkpoint.seed_fallbacks = readValue<std::uint64_t>(in);
+    checkpoint.sset_candidates = readValue<std::uint64_t>(in);
+    checkpoint.partition_sizes = readValues<std::uint64_t>(in);
+    checkpoint.assigned_vertices = readValues<int64_t>(in);
+
+    //the partition sizes end with the current partition and cover all assigned vertices
+    const auto& sizes = checkpoint.partition_sizes;
+    if(!in
+       || sizes.empty()
+       || sizes.size() > checkpoint.parameters.number_of_partitions
+       || std::accumulate(std::begin(sizes), std::end(sizes), std::uint64_t{0}) != checkpoint.assigned_vertices.size()) {
+        std::cout << "file: " << path << ": checkpoint is corrupt\n";
+        std::exit(-1);
+    }
+
+    return checkpoint;
+}
@@ -0,0 +1,417 @@
+#include <BinaryStream.hpp>
+#include <CompactHypergraph.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+
+part::CompactHypergraph::CompactHypergraph(const Hypergraph& graph,
+                                           AdjacencyEncoding encoding,
+                                           VertexOrder order)
+    : _vertex_edges(encoding),
+      _edge_vertices(encoding),
+      _number_of_vertices(graph.getVertices().size()),
+      _number_of_edges(graph.getEdges().size())
+{
+    _owned_vertex_ids = computeVertexOrder(graph, order);
+    if(order == VertexOrder::Input) {
+        _owned_edge_ids.reserve(_number_of_edges);
+        for(auto&& [edge, vtxs] : graph.getEdges()) {
+            _owned_edge_ids.push_back(edge);
+        }
+    } else {
+        _owned_edge_ids = computeEdgeOrder(graph, _owned_vertex_ids);
+    }
+    _vertex_ids = _owned_vertex_ids.data();
+    _edge_ids = _owned_edge_ids.data();
+
+    //dense id of every vertex and edge
+    std::unordered_map<int64_t, std::uint64_t> vertex_to_dense;
+    std::unordered_map<int64_t, std::uint64_t> edge_to_dense;
+    vertex_to_dense.reserve(_number_of_vertices);
+    edge_to_dense.reserve(_number_of_edges);
+    for(std::size_t i{0}; i < _number_of_vertices; ++i) {
+        vertex_to_dense.insert({_vertex_ids[i], i});
+    }
+    for(std::size_t i{0}; i < _number_of_edges; ++i) {
+        edge_to_dense.insert({_edge_ids[i], i});
+    }
+
+    std::vector<std::uint64_t> list;
+    for(std::size_t i{0}; i < _number_of_vertices; ++i) {
+        list.clear();
+        for(auto&& edge : graph.getEdgesOf(_vertex_ids[i])) {
+            list.push_back(edge_to_dense[edge]);
+        }
+        _vertex_edges.addList(list);
+    }
+    for(std::size_t i{0}; i < _number_of_edges; ++i) {
+        list.clear();
+        for(auto&& vtx : graph.getVerticesOf(_edge_ids[i])) {
+            list.push_back(vertex_to_dense[vtx]);
+        }
+        _edge_vertices.addList(list);
+    }
+
+    if(!graph.getVertexWeights().empty()) {
+        _owned_vertex_weights.reserve(_number_of_vertices);
+        for(std::size_t i{0}; i < _number_of_vertices; ++i) {
+            _owned_vertex_weights.push_back(graph.getVertexWeight(_vertex_ids[i]));
+        }
+        _vertex_weights = _owned_vertex_weights.data();
+    }
+}
+
+part::CompactHypergraph::CompactHypergraph(Adjacency vertex_edges,
+                                           Adjacency edge_vertices,
+                                           const int64_t* vertex_ids,
+                                           const int64_t* edge_ids,
+                                           std::shared_ptr<const MappedFile> file,
+                                           const std::uint64_t* vertex_weights)
+    : _vertex_edges(std::move(vertex_edges)),
+      _edge_vertices(std::move(edge_vertices)),
+      _number_of_vertices(_vertex_edges.size()),
+      _number_of_edges(_edge_vertices.size()),
+      _vertex_ids(vertex_ids),
+      _edge_ids(edge_ids),
+      _vertex_weights(vertex_weights),
+      _file(std::move(file)) {}
+
+auto part::CompactHypergraph::numberOfVertices() const
+    -> std::size_t
+{
+    return _number_of_vertices;
+}
+
+auto part::CompactHypergraph::numberOfEdges() const
+    -> std::size_t
+{
+    return _number_of_edges;
+}
+
+auto part::CompactHypergraph::degreeOf(std::uint64_t vtx) const
+    -> std::size_t
+{
+    return _vertex_edges.sizeOf(vtx);
+}
+
+auto part::CompactHypergraph::sizeOf(std::uint64_t edge) const
+    -> std::size_t
+{
+    return _edge_vertices.sizeOf(edge);
+}
+
+auto part::CompactHypergraph::prefetchEdgesOf(std::uint64_t vtx) const
+    -> void
+{
+    _vertex_edges.prefetch(vtx);
+}
+
+auto part::CompactHypergraph::weightOf(std::uint64_t vtx) const
+    -> std::uint64_t
+{
+    return _vertex_weights ? _vertex_weights[vtx] : 1;
+}
+
+auto part::CompactHypergraph::originalVertexId(std::uint64_t vtx) const
+    -> int64_t
+{
+    return _vertex_ids ? _vertex_ids[vtx] : static_cast<int64_t>(vtx);
+}
+
+auto part::CompactHypergraph::originalEdgeId(std::uint64_t edge) const
+    -> int64_t
+{
+    return _edge_ids ? _edge_ids[edge] : static_cast<int64_t>(edge);
+}
+
+auto part::CompactHypergraph::memoryUsage() const
+    -> std::size_t
+{
+    return _vertex_edges.memoryUsage()
+        + _edge_vertices.memoryUsage()
+        + _owned_vertex_ids.capacity() * sizeof(int64_t)
+        + _owned_edge_ids.capacity() * sizeof(int64_t)
+        + _owned_vertex_weights.capacity() * sizeof(std::uint64_t);
+}
+
+auto part::CompactHypergraph::getEncoding() const
+    -> AdjacencyEncoding
+{
+    return _vertex_edges.getEncoding();
+}
+
+
+part::ResidualHypergraph::ResidualHypergraph(const CompactHypergraph& graph,
+                                             uint32_t seed)
+    : _graph(graph),
+      _deleted(graph.numberOfVertices(), false),
+      _edge_sizes(graph.numberOfEdges()),
+      _remaining(graph.numberOfVertices()),
+      _engine(seed)
+{
+    for(std::size_t edge{0}; edge < _edge_sizes.size(); ++edge) {
+        _edge_sizes[edge] = graph.sizeOf(edge);
+    }
+}
+
+auto part::ResidualHypergraph::numberOfVertices() const
+    -> std::size_t
+{
+    return _remaining;
+}
+
+auto part::ResidualHypergraph::numberOfPins() const
+    -> std::size_t
+{
+    return std::accumulate(std::begin(_edge_sizes),
+                           std::end(_edge_sizes),
+                           std::size_t{0});
+}
+
+auto part::ResidualHypergraph::getVertexWeight(const int64_t& vtx) const
+    -> std::uint64_t
+{
+    return _graph.weightOf(vtx);
+}
+
+auto part::ResidualHypergraph::totalVertexWeight() const
+    -> std::uint64_t
+{
+    std::uint64_t weight{0};
+    for(std::size_t vtx{0}; vtx < _deleted.size(); ++vtx) {
+        if(!_deleted[vtx])
+            weight += _graph.weightOf(vtx);
+    }
+    return weight;
+}
+
+auto part::ResidualHypergraph::getEdgesizeOfPercentBiggestEdge(double percent) const
+    -> std::size_t
+{
+    const auto factor = 1 - percent / 100;
+    std::vector<std::size_t> size_vec;
+    for(auto&& size : _edge_sizes) {
+        if(size > 0)
+            size_vec.push_back(size);
+    }
+
+    std::nth_element(size_vec.begin(),
+                     size_vec.begin() + (size_vec.size() - 1) * factor,
+                     size_vec.end());
+
+    return size_vec[(size_vec.size() - 1) * factor];
+}
+
+auto part::ResidualHypergraph::deleteVertex(int64_t vtx)
+    -> void
+{
+    if(_deleted[vtx])
+        return;
+
+    _graph.forEachEdgeOf(vtx, [this](auto edge) {
+        --_edge_sizes[edge];
+    });
+
+    _deleted[vtx] = true;
+    _neigbour_map.erase(vtx);
+    --_remaining;
+}
+
+auto part::ResidualHypergraph::getEdgesOf(const int64_t& vtx) const
+    -> std::vector<int64_t>
+{
+    std::vector<int64_t> edges;
+    edges.reserve(_graph.degreeOf(vtx));
+    _graph.forEachEdgeOf(vtx, [&edges](auto edge) {
+        edges.push_back(edge);
+    });
+    return edges;
+}
+
+auto part::ResidualHypergraph::getSSetCandidates(const int64_t& vtx,
+                                                 std::size_t n,
+                                                 std::size_t max_edge_size) const
+    -> std::unordered_set<int64_t>
+{
+    //same search as Hypergraph::getSSetCandidates,
+    //but the vertices of an edge are decoded on the fly
+    //and deleted vertices are skipped
+    std::unordered_set<int64_t> neigbors;
+    std::size_t current_max{2};
+
+    while(current_max < max_edge_size
+          && neigbors.size() <= n) {
+
+        _graph.forEachEdgeOf(vtx, [&](auto edge) {
+            const std::size_t size = _edge_sizes[edge];
+
+            // if edge is bigger then max_edge_size then skip
+            if(size > current_max)
+                return true;
+
+            //look at most at as many vertices as still fit into the candidates
+            auto budget = size;
+            if(neigbors.size() + size > n)
+                budget = n - neigbors.size();
+
+            _graph.forEachVertexOf(edge, [&](auto neig) {
+                if(budget == 0)
+                    return false;
+                if(_deleted[neig])
+                    return true;
+
+                --budget;
+                if(static_cast<int64_t>(neig) != vtx)
+                    neigbors.insert(neig);
+                return true;
+            });
+
+            return neigbors.size() < n;
+        });
+
+        if(neigbors.size() >= n)
+            return neigbors;
+
+        current_max *= 2;
+    }
+    return neigbors;
+}
+
+auto part::ResidualHypergraph::getNodeHeuristicExactly(const int64_t& vtx) const
+    -> double
+{
+    const auto degree = _graph.degreeOf(vtx);
+
+    //we need this to not divide by zero later
+    if(degree == 0)
+        return 0;
+
+    std::size_t neigs{0};
+    _graph.forEachEdgeOf(vtx, [this, &neigs](auto edge) {
+        neigs += _edge_sizes[edge] - 1;
+    });
+
+    return neigs / degree;
+}
+
+auto part::ResidualHypergraph::getNodeHeuristicEstimate(const int64_t& vtx) const
+    -> double
+{
+    if(auto iter = _neigbour_map.find(vtx);
+       iter != _neigbour_map.end()) {
+        return iter->second;
+    }
+
+    auto neigs = getNodeHeuristicExactly(vtx);
+
+    _neigbour_map.insert({vtx, neigs});
+    return neigs;
+}
+
+auto part::ResidualHypergraph::getNodeHeuristicsExactly(const std::vector<int64_t>& vertices,
+                                                        std::vector<double>& heuristics) const
+    -> void
+{
+    for(auto&& vtx : vertices) {
+        _graph.prefetchEdgesOf(vtx);
+    }
+
+    //edges of vertex i are edges[ends[i - 1] .. ends[i]]
+    auto& edges = _batch_edges;
+    auto& ends = _batch_ends;
+    edges.clear();
+    ends.clear();
+    for(auto&& vtx : vertices) {
+        _graph.forEachEdgeOf(vtx, [&](auto edge) {
+            __builtin_prefetch(&_edge_sizes[edge]);
+            edges.push_back(edge);
+        });
+        ends.push_back(edges.size());
+    }
+
+    heuristics.clear();
+    std::size_t begin{0};
+    for(auto&& end : ends) {
+        const auto degree = end - begin;
+
+        //a plain gather, which the compiler can vectorize
+        std::size_t pins{0};
+        for(auto i = begin; i < end; ++i) {
+            pins += _edge_sizes[edges[i]];
+        }
+
+        //same as summing size - 1 over all edges like getNodeHeuristicExactly
+        heuristics.push_back(degree == 0 ? 0 : (pins - degree) / degree);
+        begin = end;
+    }
+}
+
+auto part::ResidualHypergraph::getNodeHeuristicsEstimate(const std::vector<int64_t>& vertices,
+                                                         std::vector<double>& heuristics) const
+    -> void
+{
+    //only the vertices which are not cached yet are computed, as one batch
+    std::vector<int64_t> missing;
+    std::vector<std::size_t> missing_positions;
+    heuristics.resize(vertices.size());
+    for(std::size_t i{0}; i < vertices.size(); ++i) {
+        if(auto iter = _neigbour_map.find(vertices[i]);
+           iter != _neigbour_map.end()) {
+            heuristics[i] = iter->second;
+        } else {
+            missing.push_back(vertices[i]);
+            missing_positions.push_back(i);
+        }
+    }
+
+    if(missing.empty())
+        return;
+
+    std::vector<double> computed;
+    getNodeHeuristicsExactly(missing, computed);
+    for(std::size_t i{0}; i < missing.size(); ++i) {
+        heuristics[missing_positions[i]] = computed[i];
+        _neigbour_map.insert({missing[i], computed[i]});
+    }
+}
+
+auto part::ResidualHypergraph::getRandomNode() const
+    -> int64_t
+{
+    std::uniform_int_distribution<std::size_t> dist(0, _deleted.size() - 1);
+
+    //walk to the next not deleted vertex
+    auto vtx = dist(_engine);
+    while(_deleted[vtx]) {
+        vtx = (vtx + 1) % _deleted.size();
+    }
+
+    return vtx;
+}
+
+auto part::ResidualHypergraph::getANode() const
+    -> int64_t
+{
+    while(_deleted[_first_remaining]) {
+        ++_first_remaining;
+    }
+
+    return _first_remaining;
+}
+
+auto part::ResidualHypergraph::writeState(std::ostream& out) const
+    -> void
+{
+    writeValues(out, _neigbour_map);
+    writeFormatted(out, _engine);
+}
+
+auto part::ResidualHypergraph::readState(std::istream& in)
+    -> void
+{
+    _neigbour_map.clear();
+    readValues(in, _neigbour_map);
+    readFormatted(in, _engine);
+}
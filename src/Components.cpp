@@ -0,0 +1,181 @@
+#include <Components.hpp>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include <optional>
+
+
+namespace {
+
+using Parents = std::vector<std::atomic<std::uint32_t>>;
+
+//root of @param vtx, halving the path on the way,
+//other threads may link the root below another one meanwhile
+auto findRoot(Parents& parents, std::uint32_t vtx)
+    -> std::uint32_t
+{
+    auto parent = parents[vtx].load(std::memory_order_relaxed);
+    while(parent != vtx) {
+        auto grandparent = parents[parent].load(std::memory_order_relaxed);
+        if(parent != grandparent) {
+            parents[vtx].compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+        }
+        vtx = grandparent;
+        parent = parents[vtx].load(std::memory_order_relaxed);
+    }
+    return vtx;
+}
+
+//links the bigger of both roots below the smaller one,
+//retried if the bigger root got linked by another thread in between
+auto unite(Parents& parents, std::uint32_t lhs, std::uint32_t rhs)
+    -> void
+{
+    while(true) {
+        lhs = findRoot(parents, lhs);
+        rhs = findRoot(parents, rhs);
+        if(lhs == rhs)
+            return;
+        if(lhs < rhs)
+            std::swap(lhs, rhs);
+
+        auto expected = lhs;
+        if(parents[lhs].compare_exchange_strong(expected, rhs, std::memory_order_relaxed))
+            return;
+    }
+}
+
+//what the load of a vertex is when balancing on @param balance_on, see partitionGraph
+auto loadOf(const part::CompactHypergraph& graph,
+            std::uint64_t vtx,
+            part::BalanceMode balance_on)
+    -> std::uint64_t
+{
+    switch(balance_on) {
+    case part::BalanceMode::Weight:
+        return graph.weightOf(vtx);
+    case part::BalanceMode::Pins:
+        return graph.degreeOf(vtx);
+    default:
+        return 1;
+    }
+}
+
+} // namespace
+
+auto part::findComponents(const CompactHypergraph& graph,
+                          ThreadPool& pool)
+    -> Components
+{
+    Parents parents(graph.numberOfVertices());
+    forEachRange(parents.size(), pool, [&parents](auto begin, auto end) {
+        for(auto vtx = begin; vtx < end; ++vtx) {
+            parents[vtx].store(vtx, std::memory_order_relaxed);
+        }
+    });
+
+    //every pin of an edge is united with its first pin
+    forEachRange(graph.numberOfEdges(), pool, [&](auto begin, auto end) {
+        for(auto edge = begin; edge < end; ++edge) {
+            std::optional<std::uint32_t> first;
+            graph.forEachVertexOf(edge, [&](auto vtx) {
+                if(first)
+                    unite(parents, *first, vtx);
+                else
+                    first = vtx;
+            });
+        }
+    });
+
+    Components components;
+    components.representative_of.resize(parents.size());
+    auto counts = forEachRange(parents.size(), pool, [&](auto begin, auto end) {
+        std::size_t roots{0};
+        for(auto vtx = begin; vtx < end; ++vtx) {
+            components.representative_of[vtx] = findRoot(parents, vtx);
+            roots += components.representative_of[vtx] == vtx;
+        }
+        return roots;
+    });
+    components.number_of_components = std::accumulate(std::begin(counts), std::end(counts), std::size_t{0});
+
+    return components;
+}
+
+auto part::packSmallComponents(const CompactHypergraph& graph,
+                               const Components& components,
+                               std::size_t number_of_partitions,
+                               BalanceMode balance_on)
+    -> ComponentPacking
+{
+    const auto& representative_of = components.representative_of;
+
+    std::vector<std::uint64_t> component_loads(graph.numberOfVertices(), 0);
+    std::uint64_t total_load{0};
+    for(std::uint64_t vtx{0}; vtx < graph.numberOfVertices(); ++vtx) {
+        const auto load = loadOf(graph, vtx, balance_on);
+        component_loads[representative_of[vtx]] += load;
+        total_load += load;
+    }
+
+    //the same capacities partitionGraph fills the partitions up to, when nothing was assigned yet
+    std::vector<std::uint64_t> room(number_of_partitions, (total_load + number_of_partitions - 1) / number_of_partitions);
+    if(balance_on == BalanceMode::Vertices) {
+        const auto delta = total_load / number_of_partitions;
+        const auto padded_partitions = total_load - number_of_partitions * delta;
+        for(std::size_t i{0}; i < number_of_partitions; ++i) {
+            room[i] = i < padded_partitions ? delta + 1 : delta;
+        }
+    }
+    const auto smallest_room = *std::min_element(std::begin(room), std::end(room));
+
+    std::vector<std::uint32_t> small_components;
+    for(std::uint64_t vtx{0}; vtx < graph.numberOfVertices(); ++vtx) {
+        if(representative_of[vtx] == vtx && component_loads[vtx] <= smallest_room)
+            small_components.push_back(vtx);
+    }
+
+    //biggest first, ties by the representative, so the packing only depends on the graph
+    std::sort(std::begin(small_components),
+              std::end(small_components),
+              [&component_loads](auto lhs, auto rhs) {
+                  return component_loads[lhs] > component_loads[rhs]
+                      || (component_loads[lhs] == component_loads[rhs] && lhs < rhs);
+              });
+
+    ComponentPacking packing;
+    packing.vertices.resize(number_of_partitions);
+
+    //partition of every packed component by its representative
+    constexpr auto unpacked = std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::uint32_t> partition_of(graph.numberOfVertices(), unpacked);
+
+    //partitions behind the last one with room left are full, they are not searched again
+    auto open_partitions = number_of_partitions;
+    for(auto&& component : small_components) {
+        const auto load = component_loads[component];
+        while(open_partitions > 0 && room[open_partitions - 1] == 0) {
+            --open_partitions;
+        }
+
+        for(auto i = open_partitions; i > 0; --i) {
+            if(room[i - 1] >= load) {
+                room[i - 1] -= load;
+                partition_of[component] = i - 1;
+                packing.packed_components++;
+                break;
+            }
+        }
+    }
+
+    for(std::uint64_t vtx{0}; vtx < graph.numberOfVertices(); ++vtx) {
+        const auto partition = partition_of[representative_of[vtx]];
+        if(partition != unpacked) {
+            packing.vertices[partition].push_back(vtx);
+            packing.packed_vertices++;
+        }
+    }
+
+    return packing;
+}
@@ -0,0 +1,192 @@
+#include <CompressedFile.hpp>
+#include <array>
+#include <fstream>
+#include <zlib.h>
+
+#ifdef HYPE_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+
+namespace {
+
+//istream owning its decompressing stream buffer
+class DecompressingStream : public std::istream
+{
+public:
+    DecompressingStream(const std::string& path,
+                        part::Compression compression)
+        : std::istream(nullptr),
+          _buffer(path, compression)
+    {
+        rdbuf(&_buffer);
+    }
+
+private:
+    part::DecompressingStreamBuffer _buffer;
+};
+
+} // namespace
+
+auto part::detectCompression(const std::string& path)
+    -> Compression
+{
+    std::ifstream file{path, std::ios::binary};
+    if(!file) {
+        std::cout << "file: " << path << " not found\n";
+        std::exit(-1);
+    }
+
+    std::array<unsigned char, 4> magic{};
+    file.read(reinterpret_cast<char*>(magic.data()), magic.size());
+
+    if(file.gcount() >= 2 && magic[0] == 0x1f && magic[1] == 0x8b)
+        return Compression::Gzip;
+    if(file.gcount() == 4 && magic == std::array<unsigned char, 4>{0x28, 0xb5, 0x2f, 0xfd})
+        return Compression::Zstd;
+    return Compression::None;
+}
+
+part::DecompressingStreamBuffer::DecompressingStreamBuffer(const std::string& path,
+                                                           Compression compression,
+                                                           std::size_t buffer_size,
+                                                           std::size_t number_of_buffers)
+    : _path(path),
+      _buffer_size(buffer_size),
+      _buffers(number_of_buffers),
+      _thread([this, compression] {
+          if(compression == Compression::Zstd)
+              decompressZstd();
+          else
+              decompressGzip();
+
+          _buffers.close();
+      }) {}
+
+part::DecompressingStreamBuffer::~DecompressingStreamBuffer()
+{
+    //popping makes space, so the thread is not stuck in push and sees the stop
+    _stop = true;
+    while(_buffers.pop()) {
+    }
+    _thread.join();
+}
+
+auto part::DecompressingStreamBuffer::underflow()
+    -> int_type
+{
+    if(gptr() < egptr())
+        return traits_type::to_int_type(*gptr());
+
+    auto next = _buffers.pop();
+    if(!next) {
+        if(!_error.empty()) {
+            std::cout << "file: " << _path << " could not be decompressed: " << _error << "\n";
+            std::exit(-1);
+        }
+        return traits_type::eof();
+    }
+
+    _current = std::move(*next);
+    setg(_current.data(), _current.data(), _current.data() + _current.size());
+    return traits_type::to_int_type(*gptr());
+}
+
+auto part::DecompressingStreamBuffer::decompressGzip()
+    -> void
+{
+    auto file = gzopen(_path.c_str(), "rb");
+    if(!file) {
+        _error = "gzopen failed";
+        return;
+    }
+    gzbuffer(file, 1 << 17);
+
+    while(!_stop) {
+        std::vector<char> buffer(_buffer_size);
+        auto bytes = gzread(file, buffer.data(), buffer.size());
+
+        //a truncated file ends with Z_BUF_ERROR instead of an error of gzread
+        int code{Z_OK};
+        auto message = gzerror(file, &code);
+        if(bytes < 0 || (bytes == 0 && code != Z_OK)) {
+            _error = message;
+            break;
+        }
+        if(bytes == 0)
+            break;
+
+        buffer.resize(bytes);
+        _buffers.push(std::move(buffer));
+    }
+
+    gzclose(file);
+}
+
+auto part::DecompressingStreamBuffer::decompressZstd()
+    -> void
+{
+#ifdef HYPE_WITH_ZSTD
+    std::ifstream file{_path, std::ios::binary};
+    auto context = ZSTD_createDCtx();
+
+    std::vector<char> input(ZSTD_DStreamInSize());
+    std::vector<char> buffer(_buffer_size);
+    std::size_t filled{0};
+
+    //what the last call returned, 0 only if it finished a frame
+    std::size_t remaining{0};
+
+    while(!_stop && file) {
+        file.read(input.data(), input.size());
+        ZSTD_inBuffer in{input.data(), static_cast<std::size_t>(file.gcount()), 0};
+
+        //with a full output buffer, zstd may hold more output although the input is consumed
+        bool output_full{false};
+        while((in.pos < in.size || output_full) && !_stop) {
+            ZSTD_outBuffer out{buffer.data() + filled, buffer.size() - filled, 0};
+            remaining = ZSTD_decompressStream(context, &out, &in);
+            if(ZSTD_isError(remaining)) {
+                _error = ZSTD_getErrorName(remaining);
+                ZSTD_freeDCtx(context);
+                return;
+            }
+            output_full = out.pos == out.size;
+
+            //only full buffers are passed on, the last one follows at the end
+            filled += out.pos;
+            if(filled == buffer.size()) {
+                _buffers.push(std::move(buffer));
+                buffer = std::vector<char>(_buffer_size);
+                filled = 0;
+            }
+        }
+    }
+
+    //the input ended in the middle of a frame
+    if(remaining != 0 && !_stop) {
+        _error = "the file is truncated";
+        ZSTD_freeDCtx(context);
+        return;
+    }
+
+    if(filled > 0 && !_stop) {
+        buffer.resize(filled);
+        _buffers.push(std::move(buffer));
+    }
+
+    ZSTD_freeDCtx(context);
+#else
+    _error = "zstd support is not built in, configure with -DHYPE_WITH_ZSTD=ON";
+#endif
+}
+
+auto part::openInputFile(const std::string& path)
+    -> std::unique_ptr<std::istream>
+{
+    auto compression = detectCompression(path);
+    if(compression == Compression::None)
+        return std::make_unique<std::ifstream>(path);
+
+    return std::make_unique<DecompressingStream>(path, compression);
+}
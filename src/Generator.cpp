@@ -0,0 +1,112 @@
+#include <Generator.hpp>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+
+auto part::generatePowerLawHypergraph(const GeneratorConfig& config)
+    -> Hypergraph
+{
+    std::mt19937_64 engine{config.seed};
+    Hypergraph graph;
+
+    //cumulative weights of the vertices, the i-th vertex gets
+    //a weight proportional to i^(-1 / (exponent - 1)) (zipf)
+    const auto zipf_exponent = 1 / std::max(config.vertex_degree_exponent - 1, 0.01);
+    std::vector<double> cumulative_weights;
+    cumulative_weights.reserve(config.number_of_vertices);
+    double total_weight{0};
+    for(std::size_t i{0}; i < config.number_of_vertices; ++i) {
+        total_weight += std::pow(i + 1, -zipf_exponent);
+        cumulative_weights.push_back(total_weight);
+        graph.addVertex(i + 1);
+    }
+
+    //vertex ids get shuffled, so that high degree vertices
+    //are not all at the beginning
+    std::vector<int64_t> vertex_ids(config.number_of_vertices);
+    std::iota(std::begin(vertex_ids), std::end(vertex_ids), 1);
+    std::shuffle(std::begin(vertex_ids), std::end(vertex_ids), engine);
+
+    std::uniform_real_distribution<double> uniform(0, 1);
+    const auto max_edge_size = std::min(config.max_edge_size, config.number_of_vertices);
+
+    std::vector<int64_t> node_list;
+    for(std::size_t edge{0}; edge < config.number_of_edges; ++edge) {
+        //discrete pareto distributed edge size starting at 2
+        auto size = static_cast<std::size_t>(
+            2 * std::pow(1 - uniform(engine), -1 / std::max(config.edge_size_exponent - 1, 0.01)));
+        size = std::clamp<std::size_t>(size, 2, max_edge_size);
+
+        node_list.clear();
+        for(std::size_t tries{0}; node_list.size() < size && tries < 4 * size; ++tries) {
+            auto position = std::lower_bound(std::begin(cumulative_weights),
+                                             std::end(cumulative_weights),
+                                             uniform(engine) * total_weight);
+            auto index = std::min<std::size_t>(position - std::begin(cumulative_weights),
+                                               config.number_of_vertices - 1);
+            auto vtx = vertex_ids[index];
+
+            if(std::find(std::begin(node_list), std::end(node_list), vtx) == std::end(node_list)) {
+                node_list.push_back(vtx);
+            }
+        }
+
+        graph.addNodeList(edge, node_list);
+    }
+
+    return graph;
+}
+
+auto part::writeHypergraphFile(const Hypergraph& graph,
+                               const std::string& path,
+                               ParsingMode mode)
+    -> void
+{
+    std::ofstream out{path};
+    if(!out) {
+        std::cout << "file: " << path << " could not be created\n";
+        std::exit(-1);
+    }
+
+    switch(mode) {
+    case ParsingMode::Hmetis:
+        out << graph.getEdges().size() << " " << graph.getVertices().size() << "\n";
+        for(auto&& [edge, vtxs] : graph.getEdges()) {
+            auto first = true;
+            for(auto&& vtx : vtxs) {
+                out << (first ? "" : " ") << vtx;
+                first = false;
+            }
+            out << "\n";
+        }
+        break;
+
+    case ParsingMode::EdgeList:
+        for(auto&& [vtx, edges] : graph.getVertices()) {
+            out << vtx;
+            if(!edges.empty()) {
+                out << ":";
+                auto first = true;
+                for(auto&& edge : edges) {
+                    out << (first ? " " : ", ") << edge;
+                    first = false;
+                }
+            }
+            out << "\n";
+        }
+        break;
+
+    case ParsingMode::Bipartite:
+        for(auto&& [vtx, edges] : graph.getVertices()) {
+            for(auto&& edge : edges) {
+                out << vtx << " " << edge << "\n";
+            }
+        }
+        break;
+    }
+}
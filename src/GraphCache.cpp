@@ -0,0 +1,96 @@
+#include <GraphCache.hpp>
+#include <sstream>
+
+
+part::GraphCache::GraphCache(std::size_t memory_budget,
+                             AdjacencyEncoding encoding,
+                             VertexOrder order)
+    : _memory_budget(memory_budget),
+      _encoding(encoding),
+      _order(order) {}
+
+auto part::GraphCache::get(const std::string& path,
+                           ParsingMode mode)
+    -> std::shared_ptr<const CompactHypergraph>
+{
+    std::ostringstream key_stream;
+    key_stream << mode << ":" << path;
+    const auto key = key_stream.str();
+    const auto modified = std::filesystem::last_write_time(path);
+
+    {
+        std::lock_guard lock{_mutex};
+        if(auto iter = _index.find(key);
+           iter != _index.end()) {
+            if(iter->second->modified == modified) {
+                //move to the front, it is the most recently used now
+                _entries.splice(_entries.begin(), _entries, iter->second);
+                return iter->second->graph;
+            }
+
+            //the file changed, forget the old graph
+            _memory_usage -= iter->second->bytes;
+            _entries.erase(iter->second);
+            _index.erase(iter);
+        }
+    }
+
+    //parse without holding the lock, so cached graphs can be served meanwhile
+    //if two requests miss the same graph, both parse it and the later one is kept
+    auto graph = std::make_shared<const CompactHypergraph>(parseFileIntoHypergraph(path, mode),
+                                                           _encoding,
+                                                           _order);
+    const auto bytes = graph->memoryUsage();
+
+    if(bytes > _memory_budget)
+        return graph;
+
+    std::lock_guard lock{_mutex};
+    if(auto iter = _index.find(key);
+       iter != _index.end()) {
+        _memory_usage -= iter->second->bytes;
+        _entries.erase(iter->second);
+        _index.erase(iter);
+    }
+
+    makeSpace(bytes);
+    _entries.push_front(Entry{key, modified, graph, bytes});
+    _index.insert({key, _entries.begin()});
+    _memory_usage += bytes;
+
+    return graph;
+}
+
+auto part::GraphCache::memoryUsage() const
+    -> std::size_t
+{
+    std::lock_guard lock{_mutex};
+    return _memory_usage;
+}
+
+auto part::GraphCache::describe(std::ostream& out) const
+    -> void
+{
+    std::lock_guard lock{_mutex};
+    for(auto&& entry : _entries) {
+        out << entry.key
+            << " "
+            << entry.graph->numberOfVertices()
+            << " "
+            << entry.graph->numberOfEdges()
+            << " "
+            << entry.bytes
+            << "\n";
+    }
+}
+
+auto part::GraphCache::makeSpace(std::size_t bytes)
+    -> void
+{
+    while(!_entries.empty()
+          && _memory_usage + bytes > _memory_budget) {
+        _memory_usage -= _entries.back().bytes;
+        _index.erase(_entries.back().key);
+        _entries.pop_back();
+    }
+}
@@ -0,0 +1,128 @@
+#include <Adjacency.hpp>
+#include <CompactHypergraph.hpp>
+#include <Hype.hpp>
+#include <Partitioning.hpp>
+#include <stdexcept>
+#include <string>
+
+
+namespace {
+
+//adjacency directly on a csr array of 32bit ids, nothing is copied
+auto viewOf(std::size_t size,
+            const std::uint64_t* offsets,
+            const std::uint32_t* ids)
+    -> part::Adjacency
+{
+    return part::Adjacency{part::AdjacencyEncoding::Plain,
+                           size,
+                           offsets,
+                           reinterpret_cast<const std::uint8_t*>(ids),
+                           sizeof(std::uint32_t)};
+}
+
+//throws if @param offsets does not start at 0, decreases somewhere or does not end
+//at @param number_of_pins, or if an id is not below @param id_limit.
+//with @param sorted_lists, the ids of every list have to be strictly increasing
+auto checkCsr(const char* side,
+              std::size_t size,
+              const std::uint64_t* offsets,
+              const std::uint32_t* ids,
+              std::uint64_t number_of_pins,
+              std::size_t id_limit,
+              bool sorted_lists)
+    -> void
+{
+    const auto fail = [side](const std::string& what) {
+        throw std::invalid_argument("partitionCsr: " + what + " on the " + side + " side");
+    };
+
+    if(offsets[0] != 0)
+        fail("offsets have to start at 0");
+    if(offsets[size] != number_of_pins)
+        fail("offsets have to end at the number of pins " + std::to_string(number_of_pins));
+
+    //all offsets first, so no list reads behind the ids
+    for(std::size_t i{0}; i < size; ++i) {
+        if(offsets[i] > offsets[i + 1])
+            fail("offsets have to be monotonic, list " + std::to_string(i) + " ends before it starts");
+    }
+
+    for(std::size_t i{0}; i < size; ++i) {
+        for(auto pin = offsets[i]; pin < offsets[i + 1]; ++pin) {
+            if(ids[pin] >= id_limit)
+                fail("id " + std::to_string(ids[pin]) + " in list " + std::to_string(i) + " is out of range");
+            if(sorted_lists && pin > offsets[i] && ids[pin - 1] >= ids[pin])
+                fail("list " + std::to_string(i) + " has to be sorted and free of duplicates");
+        }
+    }
+}
+
+//edges of every vertex, built from the pins of every edge
+auto transpose(const part::CsrHypergraph& graph)
+    -> part::Adjacency
+{
+    std::vector<std::vector<std::uint64_t>> edges_of(graph.number_of_vertices);
+    for(std::size_t edge{0}; edge < graph.number_of_edges; ++edge) {
+        for(auto pin = graph.edge_offsets[edge]; pin < graph.edge_offsets[edge + 1]; ++pin) {
+            edges_of[graph.edge_pins[pin]].push_back(edge);
+        }
+    }
+
+    part::Adjacency vertex_edges{part::AdjacencyEncoding::Plain};
+    for(auto&& edges : edges_of) {
+        vertex_edges.addList(std::move(edges));
+    }
+    return vertex_edges;
+}
+
+} // namespace
+
+auto part::partitionCsr(const CsrHypergraph& graph,
+                        const PartitioningOptions& options)
+    -> std::vector<std::uint32_t>
+{
+    if(!graph.edge_offsets || (graph.number_of_edges > 0 && !graph.edge_pins)) {
+        throw std::invalid_argument("partitionCsr needs the edge offsets and pins of the hypergraph");
+    }
+
+    //checked before transpose, which indexes by the pins
+    const auto number_of_pins = graph.edge_offsets[graph.number_of_edges];
+    checkCsr("edge", graph.number_of_edges, graph.edge_offsets, graph.edge_pins,
+             number_of_pins, graph.number_of_vertices, false);
+
+    const auto has_vertex_side = graph.vertex_offsets && graph.vertex_edges;
+    if(has_vertex_side) {
+        checkCsr("vertex", graph.number_of_vertices, graph.vertex_offsets, graph.vertex_edges,
+                 number_of_pins, graph.number_of_edges, true);
+    }
+
+    auto vertex_edges = has_vertex_side
+        ? viewOf(graph.number_of_vertices, graph.vertex_offsets, graph.vertex_edges)
+        : transpose(graph);
+
+    //dense ids, so no id maps are needed
+    const CompactHypergraph compact{std::move(vertex_edges),
+                                    viewOf(graph.number_of_edges, graph.edge_offsets, graph.edge_pins),
+                                    nullptr,
+                                    nullptr,
+                                    nullptr};
+
+    auto parts = partitionGraph(compact,
+                                options.number_of_partitions,
+                                options.s_set_size,
+                                options.s_set_candidates,
+                                options.ignore_biggest_edges_in_percent,
+                                options.num_neigs_flag,
+                                options.node_select_flag,
+                                options.seed);
+
+    std::vector<std::uint32_t> assignment(graph.number_of_vertices);
+    for(std::size_t i{0}; i < parts.size(); ++i) {
+        for(auto&& vtx : parts[i].getNodes()) {
+            assignment[vtx] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    return assignment;
+}
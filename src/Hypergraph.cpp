@@ -1,3 +1,4 @@
+#include <BinaryStream.hpp>
 #include <Hypergraph.hpp>
 #include <algorithm>
 #include <numeric>
@@ -88,6 +89,26 @@ auto part::Hypergraph::getNodeHeuristicEstimate(const int64_t& vtx) const
     return neigs;
 }
 
+auto part::Hypergraph::getNodeHeuristicsExactly(const std::vector<int64_t>& vertices,
+                                                std::vector<double>& heuristics) const
+    -> void
+{
+    heuristics.clear();
+    for(auto&& vtx : vertices) {
+        heuristics.push_back(getNodeHeuristicExactly(vtx));
+    }
+}
+
+auto part::Hypergraph::getNodeHeuristicsEstimate(const std::vector<int64_t>& vertices,
+                                                 std::vector<double>& heuristics) const
+    -> void
+{
+    heuristics.clear();
+    for(auto&& vtx : vertices) {
+        heuristics.push_back(getNodeHeuristicEstimate(vtx));
+    }
+}
+
 namespace {
 
 //adds elements of @param from into @param to
@@ -210,6 +231,58 @@ auto part::Hypergraph::getVertices()
     return _vertices;
 }
 
+auto part::Hypergraph::numberOfVertices() const
+    -> std::size_t
+{
+    return _vertices.size();
+}
+
+auto part::Hypergraph::numberOfPins() const
+    -> std::size_t
+{
+    std::size_t pins{0};
+    for(auto&& [edge, vtxs] : _edges) {
+        pins += vtxs.size();
+    }
+    return pins;
+}
+
+auto part::Hypergraph::setVertexWeight(int64_t vtx,
+                                       std::uint64_t weight)
+    -> void
+{
+    _vertex_weights[vtx] = weight;
+}
+
+auto part::Hypergraph::getVertexWeight(const int64_t& vtx) const
+    -> std::uint64_t
+{
+    if(auto iter = _vertex_weights.find(vtx);
+       iter != _vertex_weights.end()) {
+        return iter->second;
+    }
+    return 1;
+}
+
+auto part::Hypergraph::getVertexWeights() const
+    -> const std::unordered_map<int64_t, std::uint64_t>&
+{
+    return _vertex_weights;
+}
+
+auto part::Hypergraph::totalVertexWeight() const
+    -> std::uint64_t
+{
+    if(_vertex_weights.empty())
+        return _vertices.size();
+
+    std::uint64_t weight{0};
+    for(auto&& [vtx, edges] : _vertices) {
+        weight += getVertexWeight(vtx);
+    }
+    return weight;
+}
+
 auto part::Hypergraph::getEdgesizeOfPercentBiggestEdge(double percent) const
     -> std::size_t
 {
@@ -226,14 +299,42 @@ auto part::Hypergraph::getEdgesizeOfPercentBiggestEdge(double percent) const
     return size_vec[(size_vec.size() - 1) * factor];
 }
 
+auto part::Hypergraph::extractBiggestEdges(double percent)
+    -> EdgeMap
+{
+    EdgeMap extracted;
+    if(percent <= 0 || _edges.empty())
+        return extracted;
+
+    const auto max_edge_size = getEdgesizeOfPercentBiggestEdge(percent);
+
+    for(auto iter = _edges.begin(); iter != _edges.end();) {
+        if(iter->second.size() <= max_edge_size) {
+            ++iter;
+            continue;
+        }
+
+        //disconnect the vertices, but keep them in the graph
+        for(auto&& vtx : iter->second) {
+            _vertices[vtx].erase(iter->first);
+        }
+
+        extracted.insert(_edges.extract(iter++));
+    }
+
+    return extracted;
+}
+
 auto part::Hypergraph::getRandomNode() const
     -> int64_t
 {
-    static std::mt19937 engine{Hypergraph::random_seed};
+    if(!_engine)
+        _engine.emplace(Hypergraph::random_seed);
+
     std::uniform_int_distribution<std::size_t> dist(0, _vertices.size() - 1);
 
     auto iter = std::begin(_vertices);
-    std::advance(iter, dist(engine));
+    std::advance(iter, dist(*_engine));
 
     return iter->first;
 }
@@ -272,3 +373,31 @@ auto part::Hypergraph::setSeed(uint32_t seed)
 {
     Hypergraph::random_seed = seed;
 }
+
+auto part::Hypergraph::getSeed()
+    -> uint32_t
+{
+    return Hypergraph::random_seed;
+}
+
+auto part::Hypergraph::writeState(std::ostream& out) const
+    -> void
+{
+    writeValues(out, _neigbour_map);
+    writeValue<std::uint8_t>(out, _engine.has_value());
+    if(_engine)
+        writeFormatted(out, *_engine);
+}
+
+auto part::Hypergraph::readState(std::istream& in)
+    -> void
+{
+    _neigbour_map.clear();
+    readValues(in, _neigbour_map);
+
+    _engine.reset();
+    if(readValue<std::uint8_t>(in)) {
+        _engine.emplace();
+        readFormatted(in, *_engine);
+    }
+}
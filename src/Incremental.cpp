@@ -0,0 +1,215 @@
+#include <Incremental.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <queue>
+#include <sstream>
+
+
+namespace {
+
+auto assign(part::Assignment& assignment,
+            int64_t vtx,
+            std::size_t partition)
+    -> void
+{
+    if(assignment.sizes.size() <= partition)
+        assignment.sizes.resize(partition + 1, 0);
+
+    auto [iter, inserted] = assignment.partition_of.insert({vtx, partition});
+    if(!inserted) {
+        --assignment.sizes[iter->second];
+        iter->second = partition;
+    }
+    ++assignment.sizes[partition];
+}
+
+//reads the files written by HYPE -o starting with @param prefix
+auto readPartitionFiles(const std::string& prefix)
+    -> part::Assignment
+{
+    part::Assignment assignment;
+    for(std::size_t i{0};; ++i) {
+        std::ifstream file{prefix + "_partition_" + std::to_string(i)};
+        if(!file)
+            break;
+
+        //"id:<partition>", "nodes:" and one vertex per line
+        std::string line;
+        std::size_t partition{i};
+        while(std::getline(file, line)) {
+            if(line.rfind("id:", 0) == 0) {
+                partition = std::stoull(line.substr(3));
+            } else if(!line.empty() && line != "nodes:") {
+                assign(assignment, std::stoll(line), partition);
+            }
+        }
+
+        //partitions without vertices still count
+        if(assignment.sizes.size() <= partition)
+            assignment.sizes.resize(partition + 1, 0);
+    }
+
+    return assignment;
+}
+
+} // namespace
+
+auto part::readAssignment(const std::string& path)
+    -> Assignment
+{
+    //the input path of a run with -o usually exists as well
+    if(std::filesystem::exists(path + "_partition_0"))
+        return readPartitionFiles(path);
+
+    if(!std::filesystem::exists(path)) {
+        std::cout << "file: " << path << " not found\n";
+        std::exit(-1);
+    }
+
+    std::ifstream file{path};
+    Assignment assignment;
+    std::string line;
+    int64_t line_number{0};
+    while(std::getline(file, line)) {
+        ++line_number;
+
+        std::istringstream columns{line};
+        int64_t first;
+        if(!(columns >> first))
+            continue;
+
+        std::size_t second;
+        if(columns >> second)
+            assign(assignment, first, second);
+        else
+            assign(assignment, line_number, first);
+    }
+
+    return assignment;
+}
+
+auto part::writeAssignment(const Assignment& assignment,
+                           const std::string& path)
+    -> void
+{
+    std::vector<std::pair<int64_t, std::size_t>> sorted{std::begin(assignment.partition_of),
+                                                        std::end(assignment.partition_of)};
+    std::sort(std::begin(sorted), std::end(sorted));
+
+    std::ofstream file{path};
+    if(!file) {
+        std::cout << "file: " << path << " could not be opened\n";
+        std::exit(-1);
+    }
+
+    for(auto&& [vtx, partition] : sorted) {
+        file << vtx << " " << partition << "\n";
+    }
+}
+
+auto part::placeNewVertices(Assignment& assignment,
+                            const Hypergraph& delta,
+                            std::size_t max_edge_size)
+    -> std::size_t
+{
+    const auto number_of_partitions = assignment.sizes.size();
+    if(number_of_partitions == 0) {
+        std::cout << "the assignment does not contain any partition\n";
+        std::exit(-1);
+    }
+
+    //number of already assigned pins in the usable edges of every new vertex
+    std::unordered_map<int64_t, std::size_t> assigned_pins;
+    for(auto&& [vtx, edges] : delta.getVertices()) {
+        if(assignment.partition_of.count(vtx) == 0)
+            assigned_pins.insert({vtx, 0});
+    }
+    const auto new_vertices = assigned_pins.size();
+
+    auto usable = [&](auto edge) {
+        return delta.getVerticesOf(edge).size() <= max_edge_size;
+    };
+
+    for(auto&& [vtx, count] : assigned_pins) {
+        for(auto&& edge : delta.getEdgesOf(vtx)) {
+            if(!usable(edge))
+                continue;
+            for(auto&& neig : delta.getVerticesOf(edge)) {
+                count += assignment.partition_of.count(neig);
+            }
+        }
+    }
+
+    std::size_t total{0};
+    for(auto&& size : assignment.sizes) {
+        total += size;
+    }
+    total += new_vertices;
+    const auto capacity = (total + number_of_partitions - 1) / number_of_partitions;
+
+    //most connected vertex first, outdated entries are skipped when popped
+    std::priority_queue<std::pair<std::size_t, int64_t>> queue;
+    for(auto&& [vtx, count] : assigned_pins) {
+        queue.push({count, vtx});
+    }
+
+    std::vector<std::size_t> pins_in(number_of_partitions);
+    while(!queue.empty()) {
+        auto [count, vtx] = queue.top();
+        queue.pop();
+
+        auto iter = assigned_pins.find(vtx);
+        if(iter == assigned_pins.end() || iter->second != count)
+            continue;
+        assigned_pins.erase(iter);
+
+        std::fill(std::begin(pins_in), std::end(pins_in), 0);
+        for(auto&& edge : delta.getEdgesOf(vtx)) {
+            if(!usable(edge))
+                continue;
+            for(auto&& neig : delta.getVerticesOf(edge)) {
+                if(auto placed = assignment.partition_of.find(neig);
+                   placed != assignment.partition_of.end()) {
+                    ++pins_in[placed->second];
+                }
+            }
+        }
+
+        //most pins among the partitions with space left, the smaller one on ties
+        std::optional<std::size_t> best;
+        for(std::size_t i{0}; i < number_of_partitions; ++i) {
+            if(assignment.sizes[i] >= capacity)
+                continue;
+            if(!best
+               || pins_in[i] > pins_in[*best]
+               || (pins_in[i] == pins_in[*best] && assignment.sizes[i] < assignment.sizes[*best]))
+                best = i;
+        }
+
+        //only if partitions were bigger than the capacity before
+        if(!best) {
+            best = std::distance(std::begin(assignment.sizes),
+                                 std::min_element(std::begin(assignment.sizes),
+                                                  std::end(assignment.sizes)));
+        }
+
+        assign(assignment, vtx, *best);
+
+        //the unplaced neighbours are now connected to one more assigned pin
+        for(auto&& edge : delta.getEdgesOf(vtx)) {
+            if(!usable(edge))
+                continue;
+            for(auto&& neig : delta.getVerticesOf(edge)) {
+                if(auto waiting = assigned_pins.find(neig);
+                   waiting != assigned_pins.end()) {
+                    queue.push({++waiting->second, neig});
+                }
+            }
+        }
+    }
+
+    return new_vertices;
+}
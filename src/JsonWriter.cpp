@@ -0,0 +1,102 @@
+#include <JsonWriter.hpp>
+#include <iomanip>
+
+
+part::JsonWriter::JsonWriter(std::ostream& out)
+    : _out(out) {}
+
+auto part::JsonWriter::separate()
+    -> void
+{
+    if(_after_key) {
+        _after_key = false;
+        return;
+    }
+
+    if(!_has_members.empty()) {
+        if(_has_members.back())
+            _out << ",";
+        _has_members.back() = true;
+    }
+}
+
+auto part::JsonWriter::beginObject()
+    -> JsonWriter&
+{
+    separate();
+    _out << "{";
+    _has_members.push_back(false);
+    return *this;
+}
+
+auto part::JsonWriter::endObject()
+    -> JsonWriter&
+{
+    _has_members.pop_back();
+    _out << "}";
+    return *this;
+}
+
+auto part::JsonWriter::beginArray()
+    -> JsonWriter&
+{
+    separate();
+    _out << "[";
+    _has_members.push_back(false);
+    return *this;
+}
+
+auto part::JsonWriter::endArray()
+    -> JsonWriter&
+{
+    _has_members.pop_back();
+    _out << "]";
+    return *this;
+}
+
+auto part::JsonWriter::key(const std::string& name)
+    -> JsonWriter&
+{
+    value(name);
+    _out << ":";
+    _after_key = true;
+    return *this;
+}
+
+auto part::JsonWriter::null()
+    -> JsonWriter&
+{
+    separate();
+    _out << "null";
+    return *this;
+}
+
+auto part::JsonWriter::value(const char* str)
+    -> JsonWriter&
+{
+    return value(std::string{str});
+}
+
+auto part::JsonWriter::value(const std::string& str)
+    -> JsonWriter&
+{
+    separate();
+    _out << "\"";
+    for(auto&& c : str) {
+        switch(c) {
+        case '"': _out << "\\\""; break;
+        case '\\': _out << "\\\\"; break;
+        case '\n': _out << "\\n"; break;
+        case '\t': _out << "\\t"; break;
+        default:
+            if(static_cast<unsigned char>(c) < 0x20) {
+                _out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                     << static_cast<int>(c) << std::dec;
+            } else {
+                _out << c;
+            }
+        }
+    }
+    _out << "\"";
+    return *this;
+}
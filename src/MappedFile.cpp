@@ -0,0 +1,93 @@
+#include <MappedFile.hpp>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+
+part::MappedFile::MappedFile(MappedFile&& other) noexcept
+    : _data(std::exchange(other._data, nullptr)),
+      _size(std::exchange(other._size, 0)) {}
+
+auto part::MappedFile::operator=(MappedFile&& other) noexcept
+    -> MappedFile&
+{
+    std::swap(_data, other._data);
+    std::swap(_size, other._size);
+    return *this;
+}
+
+part::MappedFile::~MappedFile()
+{
+    if(_data) {
+        munmap(_data, _size);
+    }
+}
+
+part::MappedFile::MappedFile(const std::string& path)
+{
+    auto fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0) {
+        std::cout << "file: " << path << " could not be opened\n";
+        std::exit(-1);
+    }
+
+    struct stat file_stat;
+    fstat(fd, &file_stat);
+    _size = file_stat.st_size;
+
+    if(_size > 0) {
+        auto* mapping = mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+        if(mapping == MAP_FAILED) {
+            std::cout << "file: " << path << " could not be mapped\n";
+            std::exit(-1);
+        }
+        _data = static_cast<std::uint8_t*>(mapping);
+    }
+
+    close(fd);
+}
+
+part::MappedFile::MappedFile(const std::string& path,
+                             std::size_t size)
+    : _size(size)
+{
+    auto fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if(fd < 0 || ftruncate(fd, size) != 0) {
+        std::cout << "file: " << path << " could not be created\n";
+        std::exit(-1);
+    }
+
+    if(_size > 0) {
+        auto* mapping = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if(mapping == MAP_FAILED) {
+            std::cout << "file: " << path << " could not be mapped\n";
+            std::exit(-1);
+        }
+        _data = static_cast<std::uint8_t*>(mapping);
+    }
+
+    close(fd);
+}
+
+auto part::MappedFile::data() const
+    -> std::uint8_t*
+{
+    return _data;
+}
+
+auto part::MappedFile::size() const
+    -> std::size_t
+{
+    return _size;
+}
+
+auto part::MappedFile::adviseRandomAccess() const
+    -> void
+{
+    if(_data) {
+        madvise(_data, _size, MADV_RANDOM);
+    }
+}
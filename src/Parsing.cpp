@@ -1,5 +1,7 @@
+#include <CompressedFile.hpp>
 #include <Hypergraph.hpp>
 #include <Parsing.hpp>
+#include <ThreadPool.hpp>
 #include <algorithm>
 #include <boost/fusion/adapted/std_tuple.hpp>
 #include <boost/fusion/include/at.hpp>
@@ -8,7 +10,10 @@
 #include <boost/fusion/sequence/intrinsic_fwd.hpp>
 #include <boost/spirit/home/x3.hpp>
 #include <boost/spirit/include/support_istream_iterator.hpp>
+#include <deque>
+#include <filesystem>
 #include <fstream>
+#include <glob.h>
 #include <iostream>
 #include <vector>
 
@@ -17,7 +22,8 @@ namespace {
 
 //generates a parser for the edgelist format
 //and filling the given graph with it
-auto generate_edgelist_graph_parser(part::Hypergraph& graph)
+template<class Sink>
+auto generate_edgelist_graph_parser(Sink& graph)
 {
     namespace x3 = boost::spirit::x3;
     namespace fusion = boost::fusion;
@@ -43,32 +49,74 @@ auto generate_edgelist_graph_parser(part::Hypergraph& graph)
     return +(line[parsing_function] | empty_node[empty_function]);
 };
 
+//what the header line of a hmetis file announces
+//and how many lines were parsed after it
+struct HmetisState
+{
+    int64_t number_of_edges{0};
+    int64_t number_of_vertices{0};
+    int64_t fmt{0};
+    int64_t line{0};
+
+    //fmt 1 and 11: every edge line starts with the weight of the edge
+    auto hasEdgeWeights() const
+        -> bool
+    {
+        return fmt % 10 == 1;
+    }
+
+    //fmt 10 and 11: the edges are followed by one line per vertex with its weight
+    auto hasVertexWeights() const
+        -> bool
+    {
+        return fmt / 10 == 1;
+    }
+};
+
 //generates a parser for the hmetis format
 //and filling the given graph with it
-auto generate_hmetis_graph_parser(part::Hypergraph& graph)
+//edges are numbered in the order of their lines starting with 0,
+//vertex weights are passed to the graph, edge weights are skipped
+template<class Sink>
+auto generate_hmetis_graph_parser(Sink& graph, HmetisState& state)
 {
     namespace x3 = boost::spirit::x3;
-    namespace fusion = boost::fusion;
+    using boost::fusion::at;
+    using boost::mpl::int_;
 
-    auto parsing_function = [&graph](auto&& ctx) {
-        static int64_t edge_id{0};
-        auto vtx_list = std::move(x3::_attr(std::move(ctx)));
-        graph.addNodeList(edge_id, vtx_list);
-        ++edge_id;
+    auto header_function = [&state](auto&& ctx) {
+        state.number_of_edges = at<int_<0>>(x3::_attr(ctx));
+        state.number_of_vertices = at<int_<1>>(x3::_attr(ctx));
+        state.fmt = at<int_<2>>(x3::_attr(ctx)).value_or(0);
+    };
+
+    auto parsing_function = [&graph, &state](auto&& ctx) {
+        auto numbers = std::move(x3::_attr(std::move(ctx)));
+        const auto line = state.line++;
+
+        if(state.hasVertexWeights() && line >= state.number_of_edges) {
+            //vertices are numbered from 1 in hmetis files
+            graph.setVertexWeight(line - state.number_of_edges + 1, numbers.front());
+            return;
+        }
+
+        if(state.hasEdgeWeights())
+            numbers.erase(std::begin(numbers));
+
+        graph.addNodeList(line, numbers);
     };
 
+    auto header = (x3::int64 > x3::int64 > -x3::int64) > x3::eol;
     auto line = +x3::int64 > x3::eol;
 
-    return x3::int64
-        > x3::int64
-        > x3::eol // parse the first two numbers of the
-        //hmetis file and do nothing with it
+    return header[header_function]
         > +(line[parsing_function]);
 }
 
 //generates a parser parsing bipartite graphs
 //and filling the given hypergraph with it
-auto generate_bipartite_graph_parser(part::Hypergraph& graph)
+template<class Sink>
+auto generate_bipartite_graph_parser(Sink& graph)
 {
     namespace x3 = boost::spirit::x3;
     using boost::fusion::at;
@@ -88,8 +136,272 @@ auto generate_bipartite_graph_parser(part::Hypergraph& graph)
     return +(line[parsing_function]);
 }
 
+//parses the file at @param path into @param sink
+template<class Sink>
+auto parseFileInto(const std::string& path,
+                   part::ParsingMode mode,
+                   Sink& sink)
+    -> void
+{
+    namespace x3 = boost::spirit::x3;
+
+    //file handling, gzip and zstd compressed files are decompressed while parsing
+    auto edge_file = part::openInputFile(path);
+
+    //file iterators
+    boost::spirit::istream_iterator file_iterator(*edge_file >> std::noskipws),
+        eof;
+
+    //parse input file with the specified parser
+    switch(mode) {
+    case part::ParsingMode::Hmetis: {
+        HmetisState state;
+
+        x3::phrase_parse(file_iterator,
+                         eof,
+                         generate_hmetis_graph_parser(sink, state),
+                         x3::space - x3::eol);
+        break;
+    }
+
+    case part::ParsingMode::EdgeList:
+
+        x3::phrase_parse(file_iterator,
+                         eof,
+                         generate_edgelist_graph_parser(sink),
+                         x3::space);
+        break;
+
+    case part::ParsingMode::Bipartite:
+
+        x3::phrase_parse(file_iterator,
+                         eof,
+                         generate_bipartite_graph_parser(sink),
+                         x3::space - x3::eol);
+        break;
+    }
+}
+
+//content of one shard of a sharded input, recorded by its thread
+//and passed on to the real sink in the order of the shards
+class ShardBuffer
+{
+public:
+    auto addEdgeList(const int64_t& vtx,
+                     const std::vector<int64_t>& edge_list)
+        -> void
+    {
+        record(Kind::EdgeList, vtx, edge_list);
+    }
+
+    auto addVertex(int64_t vtx)
+        -> void
+    {
+        record(Kind::Vertex, vtx, {});
+    }
+
+    auto addNodeList(const int64_t& edge,
+                     const std::vector<int64_t>& node_list)
+        -> void
+    {
+        record(Kind::NodeList, edge, node_list);
+        _number_of_node_lists++;
+    }
+
+    auto connect(const int64_t& vtx,
+                 const int64_t& edge)
+        -> void
+    {
+        record(Kind::Connect, vtx, {edge});
+    }
+
+    auto setVertexWeight(int64_t vtx,
+                         std::uint64_t weight)
+        -> void
+    {
+        record(Kind::Weight, vtx, {static_cast<int64_t>(weight)});
+    }
+
+    //hmetis edges are numbered by their line in the shard,
+    //so the edges of the next shard start after these
+    auto numberOfNodeLists() const
+        -> int64_t
+    {
+        return _number_of_node_lists;
+    }
+
+    //passes everything recorded to @param sink,
+    //the edges of node lists are shifted by @param edge_offset
+    template<class Sink>
+    auto replayInto(Sink& sink, int64_t edge_offset) const
+        -> void
+    {
+        std::vector<int64_t> values;
+        std::size_t begin{0};
+        for(std::size_t i{0}; i < _kinds.size(); ++i) {
+            values.assign(std::begin(_values) + begin,
+                          std::begin(_values) + _ends[i]);
+            begin = _ends[i];
+
+            switch(_kinds[i]) {
+            case Kind::EdgeList:
+                sink.addEdgeList(_keys[i], values);
+                break;
+            case Kind::Vertex:
+                sink.addVertex(_keys[i]);
+                break;
+            case Kind::NodeList:
+                sink.addNodeList(_keys[i] + edge_offset, values);
+                break;
+            case Kind::Connect:
+                sink.connect(_keys[i], values.front());
+                break;
+            case Kind::Weight:
+                sink.setVertexWeight(_keys[i], static_cast<std::uint64_t>(values.front()));
+                break;
+            }
+        }
+    }
+
+private:
+    enum class Kind : std::uint8_t {
+        EdgeList,
+        Vertex,
+        NodeList,
+        Connect,
+        Weight
+    };
+
+    auto record(Kind kind,
+                int64_t key,
+                const std::vector<int64_t>& values)
+        -> void
+    {
+        _kinds.push_back(kind);
+        _keys.push_back(key);
+        _values.insert(std::end(_values), std::begin(values), std::end(values));
+        _ends.push_back(_values.size());
+    }
+
+private:
+    //one entry per call, the values of call i end at _ends[i] in _values
+    std::vector<Kind> _kinds;
+    std::vector<int64_t> _keys;
+    std::vector<std::size_t> _ends;
+    std::vector<int64_t> _values;
+    int64_t _number_of_node_lists{0};
+};
+
+//parses the files @param path stands for into @param sink,
+//several shards are parsed in parallel and passed on in order
+template<class Sink>
+auto parseShardsInto(const std::string& path,
+                     part::ParsingMode mode,
+                     Sink& sink,
+                     std::size_t number_of_threads)
+    -> void
+{
+    const auto paths = part::expandInputPath(path);
+    if(paths.size() == 1) {
+        parseFileInto(paths.front(), mode, sink);
+        return;
+    }
+
+    part::ThreadPool pool{std::min(number_of_threads == 0
+                                       ? std::size_t{std::max(std::thread::hardware_concurrency(), 1u)}
+                                       : number_of_threads,
+                                   paths.size())};
+
+    //only a few shards are parsed ahead of the one passed on,
+    //so the buffers do not hold the whole graph next to the sink
+    std::deque<std::future<ShardBuffer>> parsed;
+    std::size_t next{0};
+    auto parse_next = [&] {
+        parsed.push_back(pool.submit([&paths, mode, i = next++] {
+            ShardBuffer shard;
+            parseFileInto(paths[i], mode, shard);
+            return shard;
+        }));
+    };
+
+    while(next < paths.size() && parsed.size() < 2 * pool.numberOfThreads()) {
+        parse_next();
+    }
+
+    int64_t edge_offset{0};
+    while(!parsed.empty()) {
+        auto shard = parsed.front().get();
+        parsed.pop_front();
+        if(next < paths.size())
+            parse_next();
+
+        shard.replayInto(sink, edge_offset);
+        edge_offset += shard.numberOfNodeLists();
+    }
+}
+
 } // namespace
 
+auto part::expandInputPath(const std::string& path)
+    -> std::vector<std::string>
+{
+    std::vector<std::string> paths;
+
+    if(std::filesystem::is_directory(path)) {
+        for(auto&& entry : std::filesystem::directory_iterator{path}) {
+            const auto name = entry.path().filename().string();
+            if(entry.is_regular_file() && name.front() != '.' && name.front() != '_')
+                paths.push_back(entry.path().string());
+        }
+    } else if(path.find_first_of("*?[") != std::string::npos) {
+        glob_t matches;
+        if(glob(path.c_str(), 0, nullptr, &matches) == 0) {
+            for(std::size_t i{0}; i < matches.gl_pathc; ++i) {
+                if(std::filesystem::is_regular_file(matches.gl_pathv[i]))
+                    paths.emplace_back(matches.gl_pathv[i]);
+            }
+        }
+        globfree(&matches);
+    } else {
+        paths.push_back(path);
+    }
+
+    if(paths.empty()) {
+        std::cout << "file: " << path << " not found\n";
+        std::exit(-1);
+    }
+
+    std::sort(std::begin(paths), std::end(paths));
+    return paths;
+}
+
+auto part::inputFingerprint(const std::string& path)
+    -> std::uint64_t
+{
+    //fnv-1a over the bytes of every value
+    std::uint64_t hash{14695981039346656037ull};
+    auto add = [&hash](const void* data, std::size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for(std::size_t i{0}; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    };
+
+    for(auto&& file : expandInputPath(path)) {
+        //a file removed meanwhile counts as empty, parsing it reports the error
+        std::error_code error;
+        const auto absolute = std::filesystem::absolute(file, error).string();
+        const std::uint64_t size = std::filesystem::file_size(file, error);
+        const std::int64_t write_time = std::filesystem::last_write_time(file, error).time_since_epoch().count();
+
+        add(absolute.data(), absolute.size() + 1);
+        add(&size, sizeof(size));
+        add(&write_time, sizeof(write_time));
+    }
+
+    return hash;
+}
+
 auto part::operator>>(std::istream& in, part::ParsingMode& mode)
     -> std::istream&
 {
@@ -127,51 +439,22 @@ auto part::operator<<(std::ostream& os, const part::ParsingMode& mode)
 }
 
 auto part::parseFileIntoHypergraph(const std::string& path,
-                                   ParsingMode mode)
+                                   ParsingMode mode,
+                                   std::size_t number_of_threads)
     -> part::Hypergraph
 {
-    namespace x3 = boost::spirit::x3;
-    namespace fusion = boost::fusion;
-
     part::Hypergraph ret_graph{};
 
-    //file handling
-    std::ifstream edge_file(path);
-    if(!edge_file) {
-        std::cout << "file: " << path << "not found\n";
-        std::exit(-1);
-    }
-
-    //file iterators
-    boost::spirit::istream_iterator file_iterator(edge_file >> std::noskipws),
-        eof;
-
-    //parse input file with the specified parser
-    switch(mode) {
-    case part::ParsingMode::Hmetis:
-
-        x3::phrase_parse(file_iterator,
-                         eof,
-                         generate_hmetis_graph_parser(ret_graph),
-                         x3::space - x3::eol);
-        break;
-
-    case part::ParsingMode::EdgeList:
-
-        x3::phrase_parse(file_iterator,
-                         eof,
-                         generate_edgelist_graph_parser(ret_graph),
-                         x3::space);
-        break;
-
-    case part::ParsingMode::Bipartite:
-
-        x3::phrase_parse(file_iterator,
-                         eof,
-                         generate_bipartite_graph_parser(ret_graph),
-                         x3::space - x3::eol);
-        break;
-    }
+    parseShardsInto(path, mode, ret_graph, number_of_threads);
 
     return ret_graph;
 }
+
+auto part::parseFileIntoSink(const std::string& path,
+                             ParsingMode mode,
+                             PinSink& sink,
+                             std::size_t number_of_threads)
+    -> void
+{
+    parseShardsInto(path, mode, sink, number_of_threads);
+}
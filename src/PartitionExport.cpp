@@ -0,0 +1,221 @@
+#include <BinaryStream.hpp>
+#include <PartitionExport.hpp>
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <unordered_map>
+
+
+namespace {
+
+constexpr std::array<char, 8> subgraph_magic{'H', 'Y', 'P', 'E', 'S', 'U', 'B', '1'};
+
+//partitions spanned by the edges of a range, the owner of every edge first
+struct EdgeSpans
+{
+    std::vector<std::uint32_t> sizes;
+    std::vector<std::uint32_t> partitions;
+};
+
+} // namespace
+
+auto part::exportPartitions(const CompactHypergraph& graph,
+                            const std::vector<Partition>& partitions,
+                            const std::string& directory,
+                            ThreadPool& pool)
+    -> void
+{
+    std::unordered_map<int64_t, std::uint32_t> partition_of;
+    for(auto&& partition : partitions) {
+        for(auto&& vtx : partition.getNodes()) {
+            partition_of.emplace(vtx, partition.getId());
+        }
+    }
+
+    //partition of every vertex, by dense id
+    std::vector<std::uint32_t> owner_of(graph.numberOfVertices());
+    forEachRange(graph.numberOfVertices(), pool, [&](auto begin, auto end) {
+        for(auto vtx = begin; vtx < end; ++vtx) {
+            auto iter = partition_of.find(graph.originalVertexId(vtx));
+            if(iter == std::end(partition_of)) {
+                std::cout << "vertex " << graph.originalVertexId(vtx) << " is in no partition\n";
+                std::exit(-1);
+            }
+            owner_of[vtx] = iter->second;
+        }
+    });
+
+    //partitions spanned by every edge, the one with most pins first
+    auto ranges = forEachRange(graph.numberOfEdges(), pool, [&](auto begin, auto end) {
+        EdgeSpans spans;
+        std::vector<std::uint32_t> owners;
+        for(auto edge = begin; edge < end; ++edge) {
+            owners.clear();
+            graph.forEachVertexOf(edge, [&](auto vtx) {
+                owners.push_back(owner_of[vtx]);
+            });
+            std::sort(std::begin(owners), std::end(owners));
+
+            const auto first = spans.partitions.size();
+            std::size_t most_pins{0};
+            for(auto iter = std::begin(owners); iter != std::end(owners);) {
+                auto next = std::upper_bound(iter, std::end(owners), *iter);
+                spans.partitions.push_back(*iter);
+
+                //ascending, so a tie keeps the smaller partition
+                const std::size_t pins = std::distance(iter, next);
+                if(pins > most_pins) {
+                    most_pins = pins;
+                    std::swap(spans.partitions[first], spans.partitions.back());
+                }
+                iter = next;
+            }
+            //only the owner was moved to the front, the others are sorted again
+            std::sort(std::begin(spans.partitions) + std::min(first + 1, spans.partitions.size()),
+                      std::end(spans.partitions));
+            spans.sizes.push_back(spans.partitions.size() - first);
+        }
+        return spans;
+    });
+
+    std::vector<std::uint64_t> span_offsets{0};
+    std::vector<std::uint32_t> spanned;
+    for(auto&& range : ranges) {
+        for(auto&& size : range.sizes) {
+            span_offsets.push_back(span_offsets.back() + size);
+        }
+        spanned.insert(std::end(spanned), std::begin(range.partitions), std::end(range.partitions));
+    }
+    ranges.clear();
+
+    //vertices of every partition in ascending order, their index is their local id
+    std::vector<std::vector<std::uint32_t>> members(partitions.size());
+    for(std::uint32_t vtx{0}; vtx < graph.numberOfVertices(); ++vtx) {
+        members[owner_of[vtx]].push_back(vtx);
+    }
+
+    std::filesystem::create_directories(directory);
+
+    std::vector<std::future<void>> written;
+    for(std::size_t id{0}; id < partitions.size(); ++id) {
+        written.push_back(pool.submit([&, id] {
+            const auto& vertices = members[id];
+
+            SubHypergraph subgraph;
+            subgraph.partition = id;
+            subgraph.number_of_partitions = partitions.size();
+
+            std::vector<std::uint32_t> edges;
+            for(auto&& vtx : vertices) {
+                subgraph.vertex_ids.push_back(graph.originalVertexId(vtx));
+                subgraph.vertex_weights.push_back(graph.weightOf(vtx));
+                graph.forEachEdgeOf(vtx, [&](auto edge) {
+                    edges.push_back(edge);
+                });
+            }
+            std::sort(std::begin(edges), std::end(edges));
+            edges.erase(std::unique(std::begin(edges), std::end(edges)), std::end(edges));
+
+            auto local_edge = [&edges](auto edge) {
+                return std::distance(std::begin(edges), std::lower_bound(std::begin(edges), std::end(edges), edge));
+            };
+
+            //count the pins of every edge, then place them
+            subgraph.pin_offsets.assign(edges.size() + 1, 0);
+            for(auto&& vtx : vertices) {
+                graph.forEachEdgeOf(vtx, [&](auto edge) {
+                    subgraph.pin_offsets[local_edge(edge) + 1]++;
+                });
+            }
+            std::partial_sum(std::begin(subgraph.pin_offsets),
+                             std::end(subgraph.pin_offsets),
+                             std::begin(subgraph.pin_offsets));
+
+            subgraph.pins.resize(subgraph.pin_offsets.back());
+            auto next_pin = subgraph.pin_offsets;
+            for(std::uint32_t local{0}; local < vertices.size(); ++local) {
+                graph.forEachEdgeOf(vertices[local], [&](auto edge) {
+                    subgraph.pins[next_pin[local_edge(edge)]++] = local;
+                });
+            }
+
+            subgraph.replica_offsets.push_back(0);
+            for(auto&& edge : edges) {
+                subgraph.edge_ids.push_back(graph.originalEdgeId(edge));
+                subgraph.edge_owners.push_back(spanned[span_offsets[edge]]);
+
+                if(span_offsets[edge + 1] - span_offsets[edge] > 1) {
+                    subgraph.replicas.insert(std::end(subgraph.replicas),
+                                             std::begin(spanned) + span_offsets[edge],
+                                             std::begin(spanned) + span_offsets[edge + 1]);
+                }
+                subgraph.replica_offsets.push_back(subgraph.replicas.size());
+            }
+
+            auto path = directory + "/partition_" + std::to_string(id) + ".bin";
+            std::ofstream out{path, std::ios::binary};
+            writeSubHypergraph(out, subgraph);
+            if(!out) {
+                std::cout << "file: " << path << " could not be written\n";
+                std::exit(-1);
+            }
+        }));
+    }
+
+    for(auto&& future : written) {
+        future.get();
+    }
+}
+
+auto part::writeSubHypergraph(std::ostream& out,
+                              const SubHypergraph& subgraph)
+    -> void
+{
+    writeValue(out, subgraph_magic);
+    writeValue(out, subgraph.partition);
+    writeValue(out, subgraph.number_of_partitions);
+    writeValues(out, subgraph.vertex_ids);
+    writeValues(out, subgraph.vertex_weights);
+    writeValues(out, subgraph.edge_ids);
+    writeValues(out, subgraph.edge_owners);
+    writeValues(out, subgraph.pin_offsets);
+    writeValues(out, subgraph.pins);
+    writeValues(out, subgraph.replica_offsets);
+    writeValues(out, subgraph.replicas);
+}
+
+auto part::readSubHypergraph(const std::string& path)
+    -> SubHypergraph
+{
+    std::ifstream in{path, std::ios::binary};
+    if(!in) {
+        std::cout << "file: " << path << " not found\n";
+        std::exit(-1);
+    }
+
+    if(readValue<std::array<char, 8>>(in) != subgraph_magic) {
+        std::cout << "file: " << path << " is not a sub-hypergraph\n";
+        std::exit(-1);
+    }
+
+    SubHypergraph subgraph;
+    subgraph.partition = readValue<std::uint64_t>(in);
+    subgraph.number_of_partitions = readValue<std::uint64_t>(in);
+    subgraph.vertex_ids = readValues<int64_t>(in);
+    subgraph.vertex_weights = readValues<std::uint64_t>(in);
+    subgraph.edge_ids = readValues<int64_t>(in);
+    subgraph.edge_owners = readValues<std::uint32_t>(in);
+    subgraph.pin_offsets = readValues<std::uint64_t>(in);
+    subgraph.pins = readValues<std::uint32_t>(in);
+    subgraph.replica_offsets = readValues<std::uint64_t>(in);
+    subgraph.replicas = readValues<std::uint32_t>(in);
+
+    if(!in) {
+        std::cout << "file: " << path << " is truncated\n";
+        std::exit(-1);
+    }
+
+    return subgraph;
+}
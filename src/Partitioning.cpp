@@ -1,29 +1,79 @@
+#include <Checkpoint.hpp>
+#include <CompactHypergraph.hpp>
+#include <Components.hpp>
 #include <Hypergraph.hpp>
 #include <Partition.hpp>
 #include <Partitioning.hpp>
+#include <Progress.hpp>
 #include <SSet.hpp>
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <numeric>
-
-
-auto part::partitionGraph(Hypergraph&& graph,
-                          std::size_t number_of_partitions,
-                          std::size_t s_set_size,
-                          std::size_t s_set_candidates,
-                          double ignore_biggest_edges_in_percent,
-                          NodeHeuristicMode num_neigs_flag,
-                          NodeSelectionMode node_select_flag)
-    -> std::vector<Partition>
+#include <optional>
+#include <unordered_map>
+
+
+namespace {
+
+//neighbourhood expansion on any graph with the interface of Hypergraph
+//vertices are deleted from @param graph as soon as they are assigned
+//with @param packing, its vertices are assigned before the expansion starts
+template<class Graph>
+auto partitionGraphImpl(Graph& graph,
+                        std::size_t number_of_partitions,
+                        std::size_t s_set_size,
+                        std::size_t s_set_candidates,
+                        double ignore_biggest_edges_in_percent,
+                        part::NodeHeuristicMode num_neigs_flag,
+                        part::NodeSelectionMode node_select_flag,
+                        part::PartitioningStats* stats,
+                        part::PartitioningProgress* progress,
+                        const part::CheckpointSettings* checkpoint,
+                        part::BalanceMode balance_on,
+                        const part::ComponentPacking* packing)
+    -> std::vector<part::Partition>
 {
+    using part::Partition;
+    using part::SSet;
+
     // All the partitions will have a similar number of nodes, with a difference of at most 1 node.
     // For example, having 95 nodes and 10 partitions, the first 5 partitions will have 10 nodes each,
     // and the last 5 partitions will have 9 nodes each.
-    const auto delta = graph.getVertices().size() / number_of_partitions; // truncated
-    const auto padded_partitions = graph.getVertices().size() - number_of_partitions*delta;
+    const auto delta = graph.numberOfVertices() / number_of_partitions; // truncated
+    const auto padded_partitions = graph.numberOfVertices() - number_of_partitions*delta;
+
+    // Balancing on weights or pins, a vertex adds its weight or degree to the load of its partition.
+    // Every partition gets the remaining load divided by the remaining partitions, rounded up,
+    // so that a partition which got too much because of a heavy vertex is evened out by the next ones.
+    auto load_of = [&graph, balance_on](int64_t vtx, std::size_t degree) -> std::uint64_t {
+        switch(balance_on) {
+        case part::BalanceMode::Weight:
+            return graph.getVertexWeight(vtx);
+        case part::BalanceMode::Pins:
+            return degree;
+        default:
+            return 1;
+        }
+    };
+    const std::uint64_t total_load = balance_on == part::BalanceMode::Weight
+        ? graph.totalVertexWeight()
+        : balance_on == part::BalanceMode::Pins
+            ? graph.numberOfPins()
+            : graph.numberOfVertices();
+    std::vector<std::uint64_t> partition_loads;
+    std::uint64_t load{0};     //of the current partition
+    std::uint64_t capacity{0}; //of the current partition
 
     // helper function to check if the partition is full
-    auto is_partition_full = [&delta, &padded_partitions](std::size_t index, auto&& partition) {
+    auto is_partition_full = [&](std::size_t index, auto&& partition) {
+        if(balance_on != part::BalanceMode::Vertices) {
+            //the last partition takes every vertex which is left,
+            //vertices without weight or pins do not add to its load
+            return index + 1 < number_of_partitions && load >= capacity;
+        }
+
         if (index < padded_partitions) {
             return partition.numberOfNodes() >= delta + 1; 
         } else {
@@ -31,27 +81,203 @@ auto part::partitionGraph(Hypergraph&& graph,
         } 
     };
 
-    const auto max_edge_size =
-        graph.getEdgesizeOfPercentBiggestEdge(ignore_biggest_edges_in_percent);
+    auto start_partition = [&](std::size_t index) {
+        const auto assigned_load = std::accumulate(std::begin(partition_loads),
+                                                   std::end(partition_loads),
+                                                   std::uint64_t{0});
+        const auto remaining_partitions = number_of_partitions - index;
+        capacity = (total_load - assigned_load + remaining_partitions - 1) / remaining_partitions;
+    };
+
+    const auto perf_counters = stats && stats->perf_counters;
+
+    const part::CheckpointParameters parameters{graph.numberOfVertices(),
+                                                number_of_partitions,
+                                                s_set_size,
+                                                s_set_candidates,
+                                                ignore_biggest_edges_in_percent,
+                                                num_neigs_flag,
+                                                node_select_flag,
+                                                balance_on,
+                                                checkpoint ? checkpoint->origin : part::GraphOrigin{}};
+
+    std::optional<part::PartitioningCheckpoint> restored;
+    std::ifstream checkpoint_file;
+    if(checkpoint
+       && checkpoint->resume
+       && std::filesystem::exists(checkpoint->path)) {
+        checkpoint_file.open(checkpoint->path, std::ios::binary);
+        restored = part::readCheckpoint(checkpoint_file, checkpoint->path);
+
+        if(!(restored->parameters.origin == parameters.origin)) {
+            std::cout << "file: " << checkpoint->path
+                      << " was written by a run on another input, another graph layout or with other --reorder or --percent-of-edges-pruned\n";
+            std::exit(-1);
+        }
+        if(!(restored->parameters == parameters)) {
+            std::cout << "file: " << checkpoint->path
+                      << " was written by a run on another graph or with other parameters\n";
+            std::exit(-1);
+        }
+    }
+
+    part::PhaseTimer threshold_timer{"threshold", perf_counters};
+
+    //the threshold is taken from the whole graph, not from the rest of a resumed one
+    const std::size_t max_edge_size = restored
+        ? restored->max_edge_size
+        : graph.getEdgesizeOfPercentBiggestEdge(ignore_biggest_edges_in_percent);
+
+    if(stats)
+        stats->threshold = threshold_timer.stop();
+
+    part::PhaseTimer expansion_timer{"expansion", perf_counters};
+
+    //counted locally, so the loop does not write through the pointer
+    std::size_t sset_hits{0};
+    std::size_t seed_fallbacks{0};
+    std::size_t sset_candidates{0};
+    std::size_t packed_vertices{0};
+
+    //hands the counters to the progress reporter
+    auto publish_progress = [&](std::size_t partition) {
+        progress->current_partition.store(partition, std::memory_order_relaxed);
+        progress->sset_hits.store(sset_hits, std::memory_order_relaxed);
+        progress->assigned_vertices.store(sset_hits + seed_fallbacks + packed_vertices, std::memory_order_relaxed);
+    };
+
+    if(progress) {
+        progress->number_of_partitions.store(number_of_partitions, std::memory_order_relaxed);
+        progress->total_vertices.store(parameters.number_of_vertices, std::memory_order_relaxed);
+    }
 
     std::vector<Partition> part_vec;
 
-    for(std::size_t i = 0; i < number_of_partitions; ++i) {
-        Partition part{static_cast<size_t>(i)};
+    //only kept with checkpoints, the partitions do not remember the order of their vertices
+    std::vector<int64_t> assigned_vertices;
+    std::vector<std::uint64_t> partition_sizes;
+    auto last_checkpoint = std::chrono::steady_clock::now();
+
+    auto write_checkpoint = [&](const Partition& part, const SSet<Graph>& s_set) {
+        part::PartitioningCheckpoint state{parameters,
+                                           max_edge_size,
+                                           sset_hits,
+                                           seed_fallbacks,
+                                           sset_candidates,
+                                           partition_sizes,
+                                           assigned_vertices};
+        state.partition_sizes.push_back(part.numberOfNodes());
+
+        //written next to the checkpoint and renamed, so a crash while writing keeps the old one
+        auto temporary_path = checkpoint->path + ".tmp";
+        std::ofstream out{temporary_path, std::ios::binary};
+        part::writeCheckpoint(out, state);
+        graph.writeState(out);
+        s_set.writeState(out);
+        out.close();
+
+        if(!out) {
+            std::cout << "file: " << temporary_path << " could not be written\n";
+            std::exit(-1);
+        }
+        std::filesystem::rename(temporary_path, checkpoint->path);
+    };
+
+    std::size_t first_partition{0};
+    std::optional<Partition> resumed_part;
+    if(restored) {
+        sset_hits = restored->sset_hits;
+        seed_fallbacks = restored->seed_fallbacks;
+        sset_candidates = restored->sset_candidates;
+        first_partition = restored->partition_sizes.size() - 1;
+
+        //assign the vertices again, which leaves the graph as it was when the checkpoint was written
+        auto vertex = std::begin(restored->assigned_vertices);
+        for(std::size_t i{0}; i <= first_partition; ++i) {
+            Partition part{i};
+            load = 0;
+            for(std::uint64_t n{0}; n < restored->partition_sizes[i]; ++n, ++vertex) {
+                auto&& edges = graph.getEdgesOf(*vertex);
+                load += load_of(*vertex, edges.size());
+                part.addNode(*vertex, edges);
+                graph.deleteVertex(*vertex);
+            }
+
+            if(i < first_partition) {
+                part_vec.push_back(std::move(part));
+                partition_loads.push_back(load);
+            } else {
+                resumed_part.emplace(std::move(part));
+            }
+        }
+
+        restored->partition_sizes.pop_back();
+        partition_sizes = std::move(restored->partition_sizes);
+        assigned_vertices = std::move(restored->assigned_vertices);
+
+        graph.readState(checkpoint_file);
+    }
+
+    //the small components are assigned wholesale, so the expansion never reaches them
+    std::vector<Partition> packed_parts;
+    std::vector<std::uint64_t> packed_loads;
+    if(packing) {
+        for(std::size_t i{0}; i < number_of_partitions; ++i) {
+            Partition part{i};
+            std::uint64_t packed_load{0};
+            for(auto&& vtx : packing->vertices[i]) {
+                auto&& edges = graph.getEdgesOf(vtx);
+                packed_load += load_of(vtx, edges.size());
+                part.addNode(vtx, edges);
+                graph.deleteVertex(vtx);
+            }
+            packed_vertices += packing->vertices[i].size();
+            packed_parts.push_back(std::move(part));
+            packed_loads.push_back(packed_load);
+        }
+    }
+
+    for(std::size_t i = first_partition; i < number_of_partitions; ++i) {
+        Partition part = resumed_part && i == first_partition
+            ? std::move(*resumed_part)
+            : packing
+                ? std::move(packed_parts[i])
+                : Partition{static_cast<size_t>(i)};
+        if(!resumed_part || i != first_partition)
+            load = packing ? packed_loads[i] : 0;
+        start_partition(i);
+
+        if(progress)
+            publish_progress(i);
 
         SSet s_set{graph,
                    s_set_size,
                    num_neigs_flag,
                    node_select_flag};
 
+        if(resumed_part && i == first_partition) {
+            s_set.readState(checkpoint_file);
+            if(!checkpoint_file) {
+                std::cout << "file: " << checkpoint->path << ": checkpoint is corrupt\n";
+                std::exit(-1);
+            }
+            checkpoint_file.close();
+        }
+
         while(!is_partition_full(i, part)
-              && !graph.getVertices().empty()) {
+              && graph.numberOfVertices() > 0) {
+
+            if(s_set.isEmpty())
+                ++seed_fallbacks;
+            else
+                ++sset_hits;
 
             auto next_node = s_set.getNextNode();
 
             // insert node to C
-            part.addNode(next_node,
-                         graph.getEdgesOf(next_node));
+            auto&& edges = graph.getEdgesOf(next_node);
+            load += load_of(next_node, edges.size());
+            part.addNode(next_node, edges);
 
             // delete next node from S\C because it was added to C
             s_set.removeNode(next_node);
@@ -60,20 +286,211 @@ auto part::partitionGraph(Hypergraph&& graph,
             auto add_to_s = graph.getSSetCandidates(next_node,
                                                     s_set_candidates,
                                                     max_edge_size);
+            sset_candidates += add_to_s.size();
 
             //delete next node from graph
             graph.deleteVertex(next_node);
 
             //and expand sset
             s_set.addNodes(std::move(add_to_s));
+
+            const auto assigned = sset_hits + seed_fallbacks + packed_vertices;
+            if(progress
+               && assigned % part::PartitioningProgress::update_interval == 0)
+                publish_progress(i);
+
+            if(checkpoint) {
+                assigned_vertices.push_back(next_node);
+
+                //the clock is only read every few vertices
+                if(assigned % part::PartitioningProgress::update_interval == 0
+                   && std::chrono::steady_clock::now() - last_checkpoint >= checkpoint->interval) {
+                    write_checkpoint(part, s_set);
+                    last_checkpoint = std::chrono::steady_clock::now();
+                }
+            }
         }
 
+        partition_sizes.push_back(part.numberOfNodes());
+        partition_loads.push_back(load);
         part_vec.push_back(std::move(part));
     }
 
+    if(progress)
+        publish_progress(number_of_partitions - 1);
+
+    //a finished run does not need its checkpoint anymore
+    if(checkpoint)
+        std::filesystem::remove(checkpoint->path);
+
+    if(stats) {
+        stats->expansion = expansion_timer.stop();
+        stats->sset_hits = sset_hits;
+        stats->seed_fallbacks = seed_fallbacks;
+        stats->sset_candidates = sset_candidates;
+        stats->packed_vertices = packed_vertices;
+        stats->partition_loads = std::move(partition_loads);
+    }
+
     return part_vec;
 }
 
+//replaces every vertex and edge id in the partitions
+//with the ids returned by the given functions
+template<class VertexIdFunc, class EdgeIdFunc>
+auto relabelPartitions(std::vector<part::Partition>& part_vec,
+                       VertexIdFunc&& vertex_id,
+                       EdgeIdFunc&& edge_id)
+    -> void
+{
+    for(auto&& part : part_vec) {
+        std::unordered_set<int64_t> nodes;
+        nodes.reserve(part.getNodes().size());
+        for(auto&& node : part.getNodes()) {
+            nodes.insert(vertex_id(node));
+        }
+
+        std::unordered_set<int64_t> edges;
+        edges.reserve(part.getEdges().size());
+        for(auto&& edge : part.getEdges()) {
+            edges.insert(edge_id(edge));
+        }
+
+        part.getNodes() = std::move(nodes);
+        part.getEdges() = std::move(edges);
+    }
+}
+
+} // namespace
+
+auto part::partitionGraph(Hypergraph&& graph,
+                          std::size_t number_of_partitions,
+                          std::size_t s_set_size,
+                          std::size_t s_set_candidates,
+                          double ignore_biggest_edges_in_percent,
+                          NodeHeuristicMode num_neigs_flag,
+                          NodeSelectionMode node_select_flag,
+                          PartitioningStats* stats,
+                          PartitioningProgress* progress,
+                          const CheckpointSettings* checkpoint,
+                          BalanceMode balance_on)
+    -> std::vector<Partition>
+{
+    return partitionGraphImpl(graph,
+                              number_of_partitions,
+                              s_set_size,
+                              s_set_candidates,
+                              ignore_biggest_edges_in_percent,
+                              num_neigs_flag,
+                              node_select_flag,
+                              stats,
+                              progress,
+                              checkpoint,
+                              balance_on,
+                              nullptr);
+}
+
+auto part::partitionGraph(const CompactHypergraph& graph,
+                          std::size_t number_of_partitions,
+                          std::size_t s_set_size,
+                          std::size_t s_set_candidates,
+                          double ignore_biggest_edges_in_percent,
+                          NodeHeuristicMode num_neigs_flag,
+                          NodeSelectionMode node_select_flag,
+                          PartitioningStats* stats,
+                          PartitioningProgress* progress,
+                          const CheckpointSettings* checkpoint,
+                          BalanceMode balance_on,
+                          const ComponentPacking* packing)
+    -> std::vector<Partition>
+{
+    return partitionGraph(graph,
+                          number_of_partitions,
+                          s_set_size,
+                          s_set_candidates,
+                          ignore_biggest_edges_in_percent,
+                          num_neigs_flag,
+                          node_select_flag,
+                          Hypergraph::getSeed(),
+                          stats,
+                          progress,
+                          checkpoint,
+                          balance_on,
+                          packing);
+}
+
+auto part::partitionGraph(const CompactHypergraph& graph,
+                          std::size_t number_of_partitions,
+                          std::size_t s_set_size,
+                          std::size_t s_set_candidates,
+                          double ignore_biggest_edges_in_percent,
+                          NodeHeuristicMode num_neigs_flag,
+                          NodeSelectionMode node_select_flag,
+                          std::uint32_t seed,
+                          PartitioningStats* stats,
+                          PartitioningProgress* progress,
+                          const CheckpointSettings* checkpoint,
+                          BalanceMode balance_on,
+                          const ComponentPacking* packing)
+    -> std::vector<Partition>
+{
+    ResidualHypergraph residual{graph, seed};
+
+    auto part_vec = partitionGraphImpl(residual,
+                                       number_of_partitions,
+                                       s_set_size,
+                                       s_set_candidates,
+                                       ignore_biggest_edges_in_percent,
+                                       num_neigs_flag,
+                                       node_select_flag,
+                                       stats,
+                                       progress,
+                                       checkpoint,
+                                       balance_on,
+                                       packing);
+
+    //translate the dense ids back into the ids of the parsed graph
+    relabelPartitions(part_vec,
+                      [&graph](auto vtx) { return graph.originalVertexId(vtx); },
+                      [&graph](auto edge) { return graph.originalEdgeId(edge); });
+
+    return part_vec;
+}
+
+auto part::restoreOriginalIds(std::vector<Partition>& partitions,
+                              const std::vector<int64_t>& vertex_ids,
+                              const std::vector<int64_t>& edge_ids)
+    -> void
+{
+    relabelPartitions(partitions,
+                      [&vertex_ids](auto vtx) { return vertex_ids[vtx]; },
+                      [&edge_ids](auto edge) { return edge_ids[edge]; });
+}
+
+auto part::restorePrunedEdges(std::vector<Partition>& partitions,
+                              const Hypergraph::EdgeMap& pruned_edges)
+    -> void
+{
+    if(pruned_edges.empty())
+        return;
+
+    std::unordered_map<int64_t, std::size_t> vertex_to_partition;
+    for(std::size_t i{0}; i < partitions.size(); ++i) {
+        for(auto&& node : partitions[i].getNodes()) {
+            vertex_to_partition.insert({node, i});
+        }
+    }
+
+    for(auto&& [edge, vtxs] : pruned_edges) {
+        for(auto&& vtx : vtxs) {
+            if(auto iter = vertex_to_partition.find(vtx);
+               iter != vertex_to_partition.end()) {
+                partitions[iter->second].getEdges().insert(edge);
+            }
+        }
+    }
+}
+
 
 auto part::getSumOfExteralDegrees(const std::vector<Partition>& partitions)
     -> std::future<std::size_t>
@@ -0,0 +1,93 @@
+#include <PerfCounters.hpp>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <utility>
+
+
+namespace {
+
+auto openCounter(std::uint64_t config)
+    -> int
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    //this process on any cpu, -1 if not permitted or not supported
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+} // namespace
+
+part::PerfCounters::PerfCounters()
+    : _fds{openCounter(PERF_COUNT_HW_CPU_CYCLES),
+           openCounter(PERF_COUNT_HW_INSTRUCTIONS),
+           openCounter(PERF_COUNT_HW_CACHE_MISSES),
+           openCounter(PERF_COUNT_HW_BRANCH_MISSES)} {}
+
+part::PerfCounters::PerfCounters(PerfCounters&& other) noexcept
+    : _fds(std::exchange(other._fds, {-1, -1, -1, -1})) {}
+
+auto part::PerfCounters::operator=(PerfCounters&& other) noexcept
+    -> PerfCounters&
+{
+    std::swap(_fds, other._fds);
+    return *this;
+}
+
+part::PerfCounters::~PerfCounters()
+{
+    for(auto&& fd : _fds) {
+        if(fd >= 0)
+            close(fd);
+    }
+}
+
+auto part::PerfCounters::available() const
+    -> bool
+{
+    for(auto&& fd : _fds) {
+        if(fd >= 0)
+            return true;
+    }
+    return false;
+}
+
+auto part::PerfCounters::read() const
+    -> PerfCounts
+{
+    return PerfCounts{readCounter(_fds[0]),
+                      readCounter(_fds[1]),
+                      readCounter(_fds[2]),
+                      readCounter(_fds[3])};
+}
+
+auto part::PerfCounters::readCounter(int fd) const
+    -> std::optional<std::uint64_t>
+{
+    if(fd < 0)
+        return std::nullopt;
+
+    //value, time enabled, time running
+    std::uint64_t values[3];
+    if(::read(fd, values, sizeof(values)) != sizeof(values))
+        return std::nullopt;
+
+    //the counter was never scheduled on the pmu
+    if(values[2] == 0)
+        return values[1] == 0 ? std::optional<std::uint64_t>{0} : std::nullopt;
+
+    if(values[2] == values[1])
+        return values[0];
+
+    //extrapolate, the counter only ran for a part of the time
+    return static_cast<std::uint64_t>(static_cast<double>(values[0]) * values[1] / values[2]);
+}
@@ -0,0 +1,75 @@
+#include <Progress.hpp>
+#include <iomanip>
+#include <sstream>
+
+
+part::ProgressReporter::ProgressReporter(const PartitioningProgress& progress,
+                                         std::chrono::duration<double> interval,
+                                         std::ostream& out)
+    : _progress(progress),
+      _interval(interval),
+      _out(out),
+      _begin(std::chrono::steady_clock::now()),
+      _last_time(_begin)
+{
+    //start the thread last, all members have to be initialized
+    _thread = std::thread{[this] { run(); }};
+}
+
+part::ProgressReporter::~ProgressReporter()
+{
+    {
+        std::lock_guard lock{_mutex};
+        _stop = true;
+    }
+    _stop_signal.notify_one();
+    _thread.join();
+}
+
+auto part::ProgressReporter::run()
+    -> void
+{
+    std::unique_lock lock{_mutex};
+    while(!_stop_signal.wait_for(lock, _interval, [this] { return _stop; })) {
+        report(std::chrono::steady_clock::now());
+    }
+}
+
+auto part::ProgressReporter::report(std::chrono::steady_clock::time_point now)
+    -> void
+{
+    const auto total = _progress.total_vertices.load(std::memory_order_relaxed);
+    const auto assigned = _progress.assigned_vertices.load(std::memory_order_relaxed);
+    const auto partition = _progress.current_partition.load(std::memory_order_relaxed);
+    const auto partitions = _progress.number_of_partitions.load(std::memory_order_relaxed);
+    const auto sset_hits = _progress.sset_hits.load(std::memory_order_relaxed);
+
+    //partitioning did not start yet
+    if(total == 0)
+        return;
+
+    const auto since_last = std::chrono::duration<double>(now - _last_time).count();
+    const auto since_begin = std::chrono::duration<double>(now - _begin).count();
+    const auto rate = (assigned - _last_assigned) / since_last;
+    const auto average_rate = assigned / since_begin;
+
+    _last_time = now;
+    _last_assigned = assigned;
+
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(1)
+         << "progress: " << assigned << "/" << total << " vertices ("
+         << 100.0 * assigned / total << "%), partition "
+         << partition + 1 << "/" << partitions << ", "
+         << std::setprecision(0) << rate << " vertices/s, sset hit rate "
+         << std::setprecision(1) << (assigned > 0 ? 100.0 * sset_hits / assigned : 0.0) << "%, eta ";
+
+    if(average_rate > 0)
+        line << std::setprecision(0) << (total - assigned) / average_rate << "s";
+    else
+        line << "unknown";
+
+    //one write per line, so lines of other threads are not torn apart
+    line << "\n";
+    _out << line.str() << std::flush;
+}
@@ -0,0 +1,184 @@
+#include <Hypergraph.hpp>
+#include <Reordering.hpp>
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+
+auto part::operator>>(std::istream& in, part::VertexOrder& order)
+    -> std::istream&
+{
+    std::string token;
+    in >> token;
+    if(token == "none")
+        order = part::VertexOrder::Input;
+    else if(token == "degree")
+        order = part::VertexOrder::Degree;
+    else if(token == "bfs")
+        order = part::VertexOrder::Bfs;
+    else
+        in.setstate(std::ios_base::failbit);
+    return in;
+}
+
+auto part::operator<<(std::ostream& os, const part::VertexOrder& order)
+    -> std::ostream&
+{
+    switch(order) {
+    case part::VertexOrder::Input:
+        os << "none";
+        break;
+    case part::VertexOrder::Degree:
+        os << "degree";
+        break;
+    case part::VertexOrder::Bfs:
+        os << "bfs";
+        break;
+    default:
+        os.setstate(std::ios_base::failbit);
+        break;
+    }
+
+    return os;
+}
+
+namespace {
+
+auto degreeOrder(const part::Hypergraph& graph)
+    -> std::vector<int64_t>
+{
+    std::vector<int64_t> order;
+    order.reserve(graph.getVertices().size());
+    for(auto&& [vtx, edges] : graph.getVertices()) {
+        order.push_back(vtx);
+    }
+
+    std::stable_sort(std::begin(order),
+                     std::end(order),
+                     [&graph](auto lhs, auto rhs) {
+                         return graph.getEdgesOf(lhs).size() > graph.getEdgesOf(rhs).size();
+                     });
+    return order;
+}
+
+//breadth first search over the hypergraph, similar to reverse cuthill mckee
+//every connected component is started at its vertex with the fewest edges
+auto bfsOrder(const part::Hypergraph& graph)
+    -> std::vector<int64_t>
+{
+    auto starts = degreeOrder(graph);
+    std::reverse(std::begin(starts), std::end(starts));
+
+    std::vector<int64_t> order;
+    order.reserve(starts.size());
+    std::unordered_set<int64_t> visited_vertices;
+    std::unordered_set<int64_t> visited_edges;
+    visited_vertices.reserve(starts.size());
+    visited_edges.reserve(graph.getEdges().size());
+
+    std::deque<int64_t> queue;
+    for(auto&& start : starts) {
+        if(!visited_vertices.insert(start).second)
+            continue;
+
+        queue.push_back(start);
+        while(!queue.empty()) {
+            auto vtx = queue.front();
+            queue.pop_front();
+            order.push_back(vtx);
+
+            for(auto&& edge : graph.getEdgesOf(vtx)) {
+                if(!visited_edges.insert(edge).second)
+                    continue;
+
+                for(auto&& neig : graph.getVerticesOf(edge)) {
+                    if(visited_vertices.insert(neig).second) {
+                        queue.push_back(neig);
+                    }
+                }
+            }
+        }
+    }
+
+    return order;
+}
+
+} // namespace
+
+auto part::computeVertexOrder(const Hypergraph& graph,
+                              VertexOrder order)
+    -> std::vector<int64_t>
+{
+    switch(order) {
+    case VertexOrder::Degree:
+        return degreeOrder(graph);
+    case VertexOrder::Bfs:
+        return bfsOrder(graph);
+    default: {
+        std::vector<int64_t> input_order;
+        input_order.reserve(graph.getVertices().size());
+        for(auto&& [vtx, edges] : graph.getVertices()) {
+            input_order.push_back(vtx);
+        }
+        return input_order;
+    }
+    }
+}
+
+auto part::computeEdgeOrder(const Hypergraph& graph,
+                            const std::vector<int64_t>& vertex_order)
+    -> std::vector<int64_t>
+{
+    std::vector<int64_t> order;
+    order.reserve(graph.getEdges().size());
+    std::unordered_set<int64_t> visited_edges;
+    visited_edges.reserve(graph.getEdges().size());
+
+    for(auto&& vtx : vertex_order) {
+        for(auto&& edge : graph.getEdgesOf(vtx)) {
+            if(visited_edges.insert(edge).second) {
+                order.push_back(edge);
+            }
+        }
+    }
+
+    return order;
+}
+
+auto part::relabelHypergraph(Hypergraph&& graph,
+                             const std::vector<int64_t>& vertex_order)
+    -> RelabelledHypergraph
+{
+    RelabelledHypergraph relabelled{{},
+                                    vertex_order,
+                                    computeEdgeOrder(graph, vertex_order)};
+
+    std::unordered_map<int64_t, int64_t> edge_to_new;
+    edge_to_new.reserve(relabelled.edge_ids.size());
+    for(std::size_t i{0}; i < relabelled.edge_ids.size(); ++i) {
+        edge_to_new.insert({relabelled.edge_ids[i], i});
+    }
+
+    //insert in the new order, so the nodes of the hashmaps
+    //are allocated in that order
+    auto& new_graph = relabelled.graph;
+    for(std::size_t i{0}; i < vertex_order.size(); ++i) {
+        const auto vtx = static_cast<int64_t>(i);
+        new_graph.addVertex(vtx);
+        for(auto&& edge : graph.getEdgesOf(vertex_order[i])) {
+            new_graph.connect(vtx, edge_to_new[edge]);
+        }
+
+        if(auto&& weights = graph.getVertexWeights();
+           weights.count(vertex_order[i]) > 0) {
+            new_graph.setVertexWeight(vtx, weights.at(vertex_order[i]));
+        }
+    }
+
+    //free the old graph
+    graph = Hypergraph{};
+
+    return relabelled;
+}
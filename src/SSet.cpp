@@ -1,3 +1,5 @@
+#include <BinaryStream.hpp>
+#include <CompactHypergraph.hpp>
 #include <SSet.hpp>
 #include <algorithm>
 #include <optional>
@@ -67,15 +69,49 @@ auto part::operator<<(std::ostream& os, const part::NodeSelectionMode& num)
     return os;
 }
 
-auto part::SSet::addNodes(const std::unordered_set<int64_t>& nodes_to_add)
+auto part::operator>>(std::istream& in, part::BalanceMode& mode)
+    -> std::istream&
+{
+    std::string token;
+    in >> token;
+    if(token == "vertices")
+        mode = part::BalanceMode::Vertices;
+    else if(token == "weight")
+        mode = part::BalanceMode::Weight;
+    else if(token == "pins")
+        mode = part::BalanceMode::Pins;
+    else
+        in.setstate(std::ios_base::failbit);
+    return in;
+}
+
+auto part::operator<<(std::ostream& os, const part::BalanceMode& mode)
+    -> std::ostream&
+{
+    switch(mode) {
+    case part::BalanceMode::Vertices:
+        os << "vertices";
+        break;
+    case part::BalanceMode::Weight:
+        os << "weight";
+        break;
+    case part::BalanceMode::Pins:
+        os << "pins";
+        break;
+    default:
+        os.setstate(std::ios_base::failbit);
+        break;
+    }
+
+    return os;
+}
+
+template<class Graph>
+auto part::SSet<Graph>::addNodes(const std::unordered_set<int64_t>& nodes_to_add)
     -> void
 {
     //create vec with number of neigs pair
-    std::vector<std::pair<int64_t, std::size_t>> nodes_to_add_neig_vec;
-    for(auto&& node : nodes_to_add) {
-        auto neigs = getNodeHeuristic(node);
-        nodes_to_add_neig_vec.emplace_back(node, neigs);
-    }
+    auto nodes_to_add_neig_vec = getNodeHeuristics({std::begin(nodes_to_add), std::end(nodes_to_add)});
 
     //sort to get smallest number of neigs first
     std::sort(std::begin(nodes_to_add_neig_vec),
@@ -83,11 +119,7 @@ auto part::SSet::addNodes(const std::unordered_set<int64_t>& nodes_to_add)
               [](auto lhs, auto rhs) { return lhs.second < rhs.second; });
 
     //do the same with the nodes of this sset
-    std::vector<std::pair<int64_t, std::size_t>> nodes_neig_vec;
-    for(auto&& node : _nodes) {
-        auto neigs = getNodeHeuristic(node);
-        nodes_neig_vec.emplace_back(node, neigs);
-    }
+    auto nodes_neig_vec = getNodeHeuristics(_insertion_order);
 
     std::sort(std::begin(nodes_neig_vec),
               std::end(nodes_neig_vec),
@@ -105,21 +137,24 @@ auto part::SSet::addNodes(const std::unordered_set<int64_t>& nodes_to_add)
 
     //erase nodes
     _nodes.clear();
+    _insertion_order.clear();
 
     //replace with the smallest n nodes from the merged vector
     auto range = std::min(merged_vec.size(), _max_size);
     for(std::size_t i{0}; i < range; ++i) {
-        _nodes.insert(merged_vec[i].first);
+        if(_nodes.insert(merged_vec[i].first).second)
+            _insertion_order.push_back(merged_vec[i].first);
     }
 }
 
-auto part::SSet::getMinElement() const
+template<class Graph>
+auto part::SSet<Graph>::getMinElement() const
     -> std::optional<int64_t>
 {
     std::optional<std::size_t> neigs;
     std::optional<std::int64_t> min_node;
 
-    for(auto&& node : _nodes) {
+    for(auto&& node : _insertion_order) {
         auto num_of_neigs = getNodeHeuristic(node);
         if(num_of_neigs <= 1) {
             return node;
@@ -132,7 +167,8 @@ auto part::SSet::getMinElement() const
     return min_node;
 }
 
-auto part::SSet::getNextNode() const
+template<class Graph>
+auto part::SSet<Graph>::getNextNode() const
     -> int64_t
 {
     if(auto min_node_opt = getMinElement();
@@ -143,21 +179,42 @@ auto part::SSet::getNextNode() const
     return selectANode();
 }
 
-auto part::SSet::removeNode(const int64_t& node)
+template<class Graph>
+auto part::SSet<Graph>::isEmpty() const
+    -> bool
+{
+    return _nodes.empty();
+}
+
+template<class Graph>
+auto part::SSet<Graph>::removeNode(const int64_t& node)
     -> void
 {
-    auto iter = _nodes.begin();
-    for(; iter != _nodes.end(); iter++) {
-        if(*iter == node)
-            break;
-    }
-    if(iter != _nodes.end()) {
-        _nodes.erase(iter);
+    if(_nodes.erase(node) > 0) {
+        _insertion_order.erase(std::find(std::begin(_insertion_order),
+                                         std::end(_insertion_order),
+                                         node));
     }
 }
 
+template<class Graph>
+auto part::SSet<Graph>::writeState(std::ostream& out) const
+    -> void
+{
+    writeValues(out, _insertion_order);
+}
 
-auto part::SSet::selectANode() const
+template<class Graph>
+auto part::SSet<Graph>::readState(std::istream& in)
+    -> void
+{
+    _insertion_order = readValues<int64_t>(in);
+    _nodes = {std::begin(_insertion_order), std::end(_insertion_order)};
+}
+
+
+template<class Graph>
+auto part::SSet<Graph>::selectANode() const
     -> std::int64_t
 {
     switch(_node_select_flag) {
@@ -168,7 +225,8 @@ auto part::SSet::selectANode() const
     }
 }
 
-auto part::SSet::getNodeHeuristic(std::int64_t vtx) const
+template<class Graph>
+auto part::SSet<Graph>::getNodeHeuristic(std::int64_t vtx) const
     -> std::size_t
 {
     switch(_numb_of_neigs_flag) {
@@ -178,3 +236,28 @@ auto part::SSet::getNodeHeuristic(std::int64_t vtx) const
         return _graph.getNodeHeuristicEstimate(vtx);
     }
 }
+
+template<class Graph>
+auto part::SSet<Graph>::getNodeHeuristics(const std::vector<int64_t>& nodes) const
+    -> std::vector<std::pair<int64_t, std::size_t>>
+{
+    std::vector<double> heuristics;
+    switch(_numb_of_neigs_flag) {
+    case NodeHeuristicMode::Exact:
+        _graph.getNodeHeuristicsExactly(nodes, heuristics);
+        break;
+    default:
+        _graph.getNodeHeuristicsEstimate(nodes, heuristics);
+        break;
+    }
+
+    std::vector<std::pair<int64_t, std::size_t>> nodes_neig_vec;
+    nodes_neig_vec.reserve(nodes.size());
+    for(std::size_t i{0}; i < nodes.size(); ++i) {
+        nodes_neig_vec.emplace_back(nodes[i], heuristics[i]);
+    }
+    return nodes_neig_vec;
+}
+
+template class part::SSet<part::Hypergraph>;
+template class part::SSet<part::ResidualHypergraph>;
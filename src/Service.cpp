@@ -0,0 +1,178 @@
+#include <Partitioning.hpp>
+#include <Service.hpp>
+#include <ThreadPool.hpp>
+#include <algorithm>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <sstream>
+
+
+namespace {
+
+auto handlePartitionRequest(std::istringstream& request,
+                            std::ostream& out,
+                            part::GraphCache& cache,
+                            const part::ServiceSettings& settings)
+    -> void
+{
+    std::string path;
+    part::ParsingMode mode;
+    std::size_t number_of_partitions{0};
+    if(!(request >> path >> mode >> number_of_partitions)
+       || number_of_partitions == 0) {
+        out << "error usage: partition <path> <format> <partitions> [sset size] [seed]" << std::endl;
+        return;
+    }
+
+    auto s_set_size = settings.default_s_set_size;
+    auto seed = settings.default_seed;
+    if(!(request >> s_set_size))
+        request.clear();
+    else if(!(request >> seed))
+        request.clear();
+
+    if(!std::filesystem::is_regular_file(path)) {
+        out << "error file " << path << " not found" << std::endl;
+        return;
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+
+    //keeps the graph alive even if it is evicted from the cache meanwhile
+    auto graph = cache.get(path, mode);
+    auto parts = part::partitionGraph(*graph,
+                                      number_of_partitions,
+                                      s_set_size,
+                                      settings.s_set_candidates,
+                                      settings.ignore_biggest_edges_in_percent,
+                                      settings.num_neigs_flag,
+                                      settings.node_select_flag,
+                                      seed,
+                                      nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      settings.balance_on);
+
+    auto soed_fut = part::getSumOfExteralDegrees(parts);
+    auto k_minus_1_fut = part::getKminus1Metric(parts, graph->numberOfEdges());
+    auto edge_cut_fut = part::getHyperedgeCut(parts);
+    auto vtx_balance_fut = part::getVertexBalancing(parts);
+    auto edge_balance_fut = part::getEdgeBalancing(parts);
+
+    //stream the assignments while the metrics are computed
+    for(std::size_t i{0}; i < parts.size(); ++i) {
+        for(auto&& vtx : parts[i].getNodes()) {
+            out << vtx << " " << i << "\n";
+        }
+    }
+
+    out << "metrics "
+        << soed_fut.get() << " "
+        << k_minus_1_fut.get() << " "
+        << edge_cut_fut.get() << " "
+        << vtx_balance_fut.get() << " "
+        << edge_balance_fut.get() << "\n";
+
+    auto end = std::chrono::steady_clock::now();
+    out << "done "
+        << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count()
+        << std::endl;
+}
+
+//answers a single request other than quit
+auto serveRequest(const std::string& command,
+                  std::istringstream& request,
+                  std::ostream& out,
+                  part::GraphCache& cache,
+                  const part::ServiceSettings& settings)
+    -> void
+{
+    if(command == "partition") {
+        handlePartitionRequest(request, out, cache, settings);
+    } else if(command == "status") {
+        std::ostringstream graphs;
+        cache.describe(graphs);
+        auto listing = graphs.str();
+
+        out << "cached "
+            << std::count(std::begin(listing), std::end(listing), '\n')
+            << " "
+            << cache.memoryUsage()
+            << "\n"
+            << listing
+            << "done"
+            << std::endl;
+    } else {
+        out << "error unknown request " << command << std::endl;
+    }
+}
+
+} // namespace
+
+
+auto part::serveRequests(std::istream& in,
+                         std::ostream& out,
+                         GraphCache& cache,
+                         const ServiceSettings& settings)
+    -> void
+{
+    std::string line;
+    while(std::getline(in, line)) {
+        std::istringstream request{line};
+        std::string command;
+        if(!(request >> command))
+            continue;
+
+        if(command == "quit")
+            return;
+
+        //a failing request, like one on a malformed or removed graph file,
+        //is answered with its reason and the connection keeps being served
+        try {
+            serveRequest(command, request, out, cache, settings);
+        } catch(const std::exception& exception) {
+            std::string reason{exception.what()};
+            std::replace(std::begin(reason), std::end(reason), '\n', ' ');
+            out << "error " << reason << std::endl;
+        }
+    }
+}
+
+auto part::serveUnixSocket(const std::string& socket_path,
+                           std::size_t number_of_threads,
+                           GraphCache& cache,
+                           const ServiceSettings& settings)
+    -> void
+{
+    namespace asio = boost::asio;
+    using asio::local::stream_protocol;
+
+    //a socket left behind by an earlier run would make bind fail,
+    //any other file at the path is kept
+    if(std::filesystem::is_socket(socket_path)) {
+        std::filesystem::remove(socket_path);
+    } else if(std::filesystem::exists(socket_path)) {
+        std::cout << "file: " << socket_path << " exists and is not a socket\n";
+        std::exit(-1);
+    }
+
+    asio::io_context context;
+    stream_protocol::acceptor acceptor{context, stream_protocol::endpoint{socket_path}};
+    ThreadPool pool{number_of_threads};
+
+    while(true) {
+        auto connection = std::make_shared<stream_protocol::iostream>();
+        boost::system::error_code error;
+        acceptor.accept(connection->socket(), error);
+        if(error) {
+            std::cerr << "accepting a connection failed: " << error.message() << "\n";
+            continue;
+        }
+
+        pool.submit([connection, &cache, &settings] {
+            serveRequests(*connection, *connection, cache, settings);
+        });
+    }
+}
@@ -0,0 +1,109 @@
+#include <Statistics.hpp>
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <sys/resource.h>
+#include <unistd.h>
+
+
+part::PhaseTimer::PhaseTimer(std::string name,
+                             bool perf_counters)
+    : _name(std::move(name))
+{
+    //open the counters first, so that opening them is not measured
+    if(perf_counters)
+        _counters.emplace();
+
+    _wall_begin = std::chrono::steady_clock::now();
+    _cpu_begin = processCpuSeconds();
+}
+
+auto part::PhaseTimer::stop() const
+    -> PhaseStatistics
+{
+    PhaseStatistics phase;
+    if(_counters)
+        phase.counters = _counters->read();
+
+    phase.name = _name;
+    phase.wall_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - _wall_begin)
+            .count();
+    phase.cpu_seconds = processCpuSeconds() - _cpu_begin;
+    phase.rss_bytes = currentRssBytes();
+    phase.peak_rss_bytes = peakRssBytes();
+    return phase;
+}
+
+auto part::processCpuSeconds()
+    -> double
+{
+    timespec time;
+    if(clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time) != 0)
+        return 0;
+
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+auto part::currentRssBytes()
+    -> std::size_t
+{
+    //second value is the number of resident pages
+    std::ifstream statm{"/proc/self/statm"};
+    std::size_t size{0};
+    std::size_t resident{0};
+    if(!(statm >> size >> resident))
+        return 0;
+
+    return resident * sysconf(_SC_PAGESIZE);
+}
+
+auto part::peakRssBytes()
+    -> std::size_t
+{
+    rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+    //linux reports kilobytes, and updates the peak lazily,
+    //so it can be behind the current resident memory
+    return std::max(static_cast<std::size_t>(usage.ru_maxrss) * 1024,
+                    currentRssBytes());
+}
+
+auto part::writePerfCounts(JsonWriter& json, const PerfCounts& counts)
+    -> void
+{
+    auto write = [&json](const std::string& name, const auto& count) {
+        json.key(name);
+        if(count)
+            json.value(count.value());
+        else
+            json.null();
+    };
+
+    json.beginObject();
+    write("cycles", counts.cycles);
+    write("instructions", counts.instructions);
+    write("llc_misses", counts.llc_misses);
+    write("branch_misses", counts.branch_misses);
+    json.endObject();
+}
+
+auto part::writePhase(JsonWriter& json, const PhaseStatistics& phase)
+    -> void
+{
+    json.beginObject()
+        .key("name").value(phase.name)
+        .key("wall_seconds").value(phase.wall_seconds)
+        .key("cpu_seconds").value(phase.cpu_seconds)
+        .key("rss_bytes").value(phase.rss_bytes)
+        .key("peak_rss_bytes").value(phase.peak_rss_bytes);
+
+    if(phase.counters) {
+        json.key("counters");
+        writePerfCounts(json, *phase.counters);
+    }
+
+    json.endObject();
+}
@@ -0,0 +1,193 @@
+#include <BlockingQueue.hpp>
+#include <Parsing.hpp>
+#include <Partition.hpp>
+#include <Streaming.hpp>
+#include <algorithm>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+namespace {
+
+//a vertex and the edges it is connected to
+using Arrival = std::pair<int64_t, std::vector<int64_t>>;
+using ArrivalBatch = std::vector<Arrival>;
+
+//number of vertices passed between the threads at once
+constexpr std::size_t batch_size{1024};
+//number of batches waiting to be assigned
+constexpr std::size_t queue_capacity{64};
+
+//collects the parsed vertices into batches
+//and hands them to the assigning thread
+class ArrivalSink : public part::PinSink
+{
+public:
+    ArrivalSink(part::BlockingQueue<ArrivalBatch>& queue)
+        : _queue(queue) {}
+
+    auto addEdgeList(const int64_t& vtx,
+                     const std::vector<int64_t>& edge_list)
+        -> void override
+    {
+        flushVertex();
+        _batch.emplace_back(vtx, edge_list);
+        flushBatchIfFull();
+    }
+
+    auto addVertex(int64_t vtx)
+        -> void override
+    {
+        flushVertex();
+        _batch.emplace_back(vtx, std::vector<int64_t>{});
+        flushBatchIfFull();
+    }
+
+    //hmetis input is rejected before streaming starts, see partitionStream
+    auto addNodeList(const int64_t& /*edge*/,
+                     const std::vector<int64_t>& /*node_list*/)
+        -> void override {}
+
+    //lines of the same vertex are collected until the next vertex starts
+    auto connect(const int64_t& vtx,
+                 const int64_t& edge)
+        -> void override
+    {
+        if(_current && _current->first != vtx) {
+            flushVertex();
+        }
+        if(!_current) {
+            _current = Arrival{vtx, {}};
+        }
+        _current->second.push_back(edge);
+    }
+
+    auto finish()
+        -> void
+    {
+        flushVertex();
+        if(!_batch.empty()) {
+            _queue.push(std::move(_batch));
+        }
+        _queue.close();
+    }
+
+private:
+    auto flushVertex()
+        -> void
+    {
+        if(_current) {
+            _batch.push_back(std::move(_current.value()));
+            _current.reset();
+            flushBatchIfFull();
+        }
+    }
+
+    auto flushBatchIfFull()
+        -> void
+    {
+        if(_batch.size() >= batch_size) {
+            _queue.push(std::move(_batch));
+            _batch = {};
+            _batch.reserve(batch_size);
+        }
+    }
+
+    part::BlockingQueue<ArrivalBatch>& _queue;
+    ArrivalBatch _batch;
+    std::optional<Arrival> _current;
+};
+
+} // namespace
+
+auto part::partitionStream(const std::string& path,
+                           ParsingMode mode,
+                           std::size_t number_of_partitions,
+                           std::size_t balance_slack)
+    -> StreamedPartitioning
+{
+    BlockingQueue<ArrivalBatch> queue{queue_capacity};
+
+    //parse on a separate thread, overlapping with the assignment
+    std::thread parser{[&] {
+        ArrivalSink sink{queue};
+        parseFileIntoSink(path, mode, sink);
+        sink.finish();
+    }};
+
+    StreamedPartitioning result{{}, 0, 0};
+    auto& parts = result.partitions;
+    for(std::size_t i{0}; i < number_of_partitions; ++i) {
+        parts.emplace_back(i);
+    }
+
+    //partition every seen vertex was assigned to
+    std::unordered_map<int64_t, std::size_t> assignment;
+    std::vector<std::size_t> scores(number_of_partitions);
+
+    while(auto batch = queue.pop()) {
+        for(auto&& [vtx, edges] : batch.value()) {
+            //vertices appearing again stay in their partition
+            if(auto iter = assignment.find(vtx);
+               iter != assignment.end()) {
+                for(auto&& edge : edges) {
+                    if(std::none_of(std::begin(parts),
+                                    std::end(parts),
+                                    [&edge](auto&& part) { return part.hasEdge(edge); })) {
+                        ++result.number_of_edges;
+                    }
+                }
+                parts[iter->second].addNode(vtx, edges);
+                continue;
+            }
+
+            //count the edges every partition shares with the vertex
+            std::fill(std::begin(scores), std::end(scores), 0);
+            for(auto&& edge : edges) {
+                bool seen{false};
+                for(std::size_t i{0}; i < number_of_partitions; ++i) {
+                    if(parts[i].hasEdge(edge)) {
+                        ++scores[i];
+                        seen = true;
+                    }
+                }
+                if(!seen) {
+                    ++result.number_of_edges;
+                }
+            }
+
+            //take the partition with the most shared edges,
+            //which is not too big, prefer smaller partitions on ties
+            auto smallest = std::min_element(std::begin(parts),
+                                             std::end(parts),
+                                             [](auto&& lhs, auto&& rhs) {
+                                                 return lhs.numberOfNodes() < rhs.numberOfNodes();
+                                             })
+                                ->numberOfNodes();
+
+            std::size_t best{0};
+            std::optional<std::size_t> best_score;
+            for(std::size_t i{0}; i < number_of_partitions; ++i) {
+                if(parts[i].numberOfNodes() > smallest + balance_slack)
+                    continue;
+
+                if(!best_score
+                   || scores[i] > best_score.value()
+                   || (scores[i] == best_score.value()
+                       && parts[i].numberOfNodes() < parts[best].numberOfNodes())) {
+                    best = i;
+                    best_score = scores[i];
+                }
+            }
+
+            parts[best].addNode(vtx, edges);
+            assignment.insert({vtx, best});
+            ++result.number_of_vertices;
+        }
+    }
+
+    parser.join();
+
+    return result;
+}
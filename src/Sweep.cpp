@@ -0,0 +1,158 @@
+#include <Partitioning.hpp>
+#include <Sweep.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <optional>
+#include <string>
+
+
+auto part::operator>>(std::istream& in, part::PortfolioMetric& metric)
+    -> std::istream&
+{
+    std::string token;
+    in >> token;
+    if(token == "k-1")
+        metric = part::PortfolioMetric::KMinus1;
+    else if(token == "soed")
+        metric = part::PortfolioMetric::Soed;
+    else if(token == "cut")
+        metric = part::PortfolioMetric::HyperedgeCut;
+    else
+        in.setstate(std::ios_base::failbit);
+    return in;
+}
+
+auto part::operator<<(std::ostream& os, const part::PortfolioMetric& metric)
+    -> std::ostream&
+{
+    switch(metric) {
+    case part::PortfolioMetric::KMinus1:
+        os << "k-1";
+        break;
+    case part::PortfolioMetric::Soed:
+        os << "soed";
+        break;
+    case part::PortfolioMetric::HyperedgeCut:
+        os << "cut";
+        break;
+    default:
+        os.setstate(std::ios_base::failbit);
+        break;
+    }
+
+    return os;
+}
+
+
+auto part::makeRunConfigurations(const std::vector<std::size_t>& partition_counts,
+                                 const std::vector<std::size_t>& s_set_sizes,
+                                 const std::vector<std::uint32_t>& seeds)
+    -> std::vector<RunConfiguration>
+{
+    std::vector<RunConfiguration> configurations;
+    configurations.reserve(partition_counts.size() * s_set_sizes.size() * seeds.size());
+
+    for(auto&& k : partition_counts) {
+        for(auto&& s_set_size : s_set_sizes) {
+            for(auto&& seed : seeds) {
+                configurations.push_back(RunConfiguration{k, s_set_size, seed});
+            }
+        }
+    }
+
+    return configurations;
+}
+
+auto part::runConfigurations(const CompactHypergraph& graph,
+                             const std::vector<RunConfiguration>& configurations,
+                             const SweepSettings& settings,
+                             ThreadPool& pool)
+    -> std::vector<std::future<RunResult>>
+{
+    std::vector<std::future<RunResult>> results;
+    results.reserve(configurations.size());
+
+    for(auto&& configuration : configurations) {
+        results.push_back(pool.submit([&graph, configuration, settings] {
+            auto begin = std::chrono::steady_clock::now();
+
+            auto parts = partitionGraph(graph,
+                                        configuration.number_of_partitions,
+                                        configuration.s_set_size,
+                                        settings.s_set_candidates,
+                                        settings.ignore_biggest_edges_in_percent,
+                                        settings.num_neigs_flag,
+                                        settings.node_select_flag,
+                                        configuration.seed,
+                                        nullptr,
+                                        nullptr,
+                                        nullptr,
+                                        settings.balance_on);
+
+            auto end = std::chrono::steady_clock::now();
+
+            //one metric after the other,
+            //the pool already keeps every core busy
+            RunResult result;
+            result.configuration = configuration;
+            result.milliseconds = std::chrono::duration<double, std::milli>(end - begin).count();
+            result.soed = getSumOfExteralDegrees(parts).get();
+            result.vertex_balancing = getVertexBalancing(parts).get();
+            result.edge_balancing = getEdgeBalancing(parts).get();
+            result.hyperedge_cut = getHyperedgeCut(parts).get();
+            result.k_minus_1 = getKminus1Metric(parts, graph.numberOfEdges()).get();
+
+            if(settings.keep_partitions)
+                result.partitions = std::move(parts);
+
+            return result;
+        }));
+    }
+
+    return results;
+}
+
+auto part::metricOf(const RunResult& result,
+                    PortfolioMetric metric)
+    -> std::size_t
+{
+    switch(metric) {
+    case PortfolioMetric::Soed:
+        return result.soed;
+    case PortfolioMetric::HyperedgeCut:
+        return result.hyperedge_cut;
+    default:
+        return result.k_minus_1;
+    }
+}
+
+auto part::selectBestRun(std::vector<std::future<RunResult>>& results,
+                         PortfolioMetric metric,
+                         PortfolioSpread& spread)
+    -> RunResult
+{
+    std::optional<RunResult> best;
+    std::vector<double> values;
+
+    for(auto&& future : results) {
+        auto result = future.get();
+        values.push_back(metricOf(result, metric));
+
+        if(!best || metricOf(result, metric) < metricOf(*best, metric))
+            best = std::move(result);
+    }
+
+    spread.min = metricOf(*best, metric);
+    spread.max = static_cast<std::size_t>(*std::max_element(std::begin(values), std::end(values)));
+    spread.mean = std::accumulate(std::begin(values), std::end(values), 0.0) / values.size();
+
+    double squares{0};
+    for(auto&& value : values) {
+        squares += (value - spread.mean) * (value - spread.mean);
+    }
+    spread.standard_deviation = std::sqrt(squares / values.size());
+
+    return std::move(*best);
+}
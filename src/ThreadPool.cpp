@@ -0,0 +1,37 @@
+#include <ThreadPool.hpp>
+#include <algorithm>
+#include <limits>
+
+
+part::ThreadPool::ThreadPool(std::size_t number_of_threads)
+    : _tasks(std::numeric_limits<std::size_t>::max())
+{
+    if(number_of_threads == 0)
+        number_of_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    for(std::size_t i{0}; i < number_of_threads; ++i) {
+        _threads.emplace_back([this] { work(); });
+    }
+}
+
+part::ThreadPool::~ThreadPool()
+{
+    _tasks.close();
+    for(auto&& thread : _threads) {
+        thread.join();
+    }
+}
+
+auto part::ThreadPool::numberOfThreads() const
+    -> std::size_t
+{
+    return _threads.size();
+}
+
+auto part::ThreadPool::work()
+    -> void
+{
+    while(auto task = _tasks.pop()) {
+        (*task)();
+    }
+}
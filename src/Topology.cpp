@@ -0,0 +1,216 @@
+#include <CompactHypergraph.hpp>
+#include <Partitioning.hpp>
+#include <Topology.hpp>
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+
+namespace {
+
+//the vertices of @param vertices with all their edges,
+//edges are kept even if only one of their vertices is in the subgraph,
+//so that the partitions of the subgraph hold all edges of their vertices
+auto inducedSubgraph(const part::Hypergraph& graph,
+                     const std::unordered_set<int64_t>& vertices)
+    -> part::Hypergraph
+{
+    part::Hypergraph subgraph;
+    for(auto&& vtx : vertices) {
+        subgraph.addVertex(vtx);
+        for(auto&& edge : graph.getEdgesOf(vtx)) {
+            subgraph.connect(vtx, edge);
+        }
+
+        if(graph.getVertexWeights().count(vtx) > 0)
+            subgraph.setVertexWeight(vtx, graph.getVertexWeight(vtx));
+    }
+    return subgraph;
+}
+
+//result of partitioning one part of a level
+struct SplitResult
+{
+    std::vector<part::Partition> partitions;
+    std::vector<part::Hypergraph> subgraphs; //of every partition, empty on the innermost level
+};
+
+} // namespace
+
+auto part::Topology::numberOfPartitions() const
+    -> std::size_t
+{
+    return std::accumulate(std::begin(levels),
+                           std::end(levels),
+                           std::size_t{1},
+                           std::multiplies<>{});
+}
+
+auto part::operator>>(std::istream& in, part::Topology& topology)
+    -> std::istream&
+{
+    std::string token;
+    in >> token;
+
+    topology.levels.clear();
+    std::istringstream levels{token};
+    std::string level;
+    while(std::getline(levels, level, 'x')) {
+        try {
+            std::size_t parsed{0};
+            auto parts = std::stoull(level, &parsed);
+            if(parsed != level.size() || parts == 0)
+                throw std::invalid_argument{level};
+            topology.levels.push_back(parts);
+        } catch(const std::exception&) {
+            in.setstate(std::ios_base::failbit);
+            return in;
+        }
+    }
+
+    if(topology.levels.empty())
+        in.setstate(std::ios_base::failbit);
+    return in;
+}
+
+auto part::operator<<(std::ostream& os, const part::Topology& topology)
+    -> std::ostream&
+{
+    for(std::size_t i{0}; i < topology.levels.size(); ++i) {
+        if(i > 0)
+            os << "x";
+        os << topology.levels[i];
+    }
+    return os;
+}
+
+auto part::partitionTopology(const Hypergraph& graph,
+                             const Topology& topology,
+                             const TopologySettings& settings,
+                             ThreadPool& pool)
+    -> std::vector<Partition>
+{
+    //the graphs of the parts of the current level, the whole graph on the outermost one
+    std::vector<Hypergraph> level_graphs;
+    std::vector<Partition> leaves;
+
+    for(std::size_t level{0}; level < topology.levels.size(); ++level) {
+        const auto parts = topology.levels[level];
+        const auto innermost = level + 1 == topology.levels.size();
+        const auto number_of_graphs = level == 0 ? std::size_t{1} : level_graphs.size();
+
+        std::vector<std::future<SplitResult>> results;
+        for(std::size_t i{0}; i < number_of_graphs; ++i) {
+            const auto& part_graph = level == 0 ? graph : level_graphs[i];
+
+            //every graph of a level is seeded on its own, whichever thread partitions it
+            const auto seed = taskSeed(taskSeed(settings.seed, level), i);
+
+            results.push_back(pool.submit([&part_graph, &settings, parts, innermost, seed] {
+                //partitioned read only, so the graph is still there to build the subgraphs
+                const CompactHypergraph compact{part_graph, settings.encoding};
+                SplitResult result{partitionGraph(compact,
+                                                  parts,
+                                                  settings.s_set_size,
+                                                  settings.s_set_candidates,
+                                                  settings.ignore_biggest_edges_in_percent,
+                                                  settings.num_neigs_flag,
+                                                  settings.node_select_flag,
+                                                  seed,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  settings.balance_on),
+                                   {}};
+
+                if(!innermost) {
+                    for(auto&& partition : result.partitions) {
+                        result.subgraphs.push_back(inducedSubgraph(part_graph, partition.getNodes()));
+                    }
+                }
+                return result;
+            }));
+        }
+
+        //collected in order, the parts of graph i get the indices i*parts .. i*parts + parts - 1
+        std::vector<Hypergraph> next_graphs;
+        for(auto&& future : results) {
+            auto result = future.get();
+            if(innermost) {
+                for(auto&& partition : result.partitions) {
+                    Partition leaf{leaves.size()};
+                    leaf.getNodes() = std::move(partition.getNodes());
+                    leaf.getEdges() = std::move(partition.getEdges());
+                    leaves.push_back(std::move(leaf));
+                }
+            } else {
+                std::move(std::begin(result.subgraphs),
+                          std::end(result.subgraphs),
+                          std::back_inserter(next_graphs));
+            }
+        }
+
+        level_graphs = std::move(next_graphs);
+    }
+
+    return leaves;
+}
+
+auto part::defaultLinkCosts(const Topology& topology)
+    -> std::vector<std::size_t>
+{
+    std::vector<std::size_t> costs(topology.levels.size());
+    std::size_t cost{1};
+    for(auto iter = costs.rbegin(); iter != costs.rend(); ++iter) {
+        *iter = cost;
+        cost *= 10;
+    }
+    return costs;
+}
+
+auto part::getTopologyCost(const std::vector<Partition>& partitions,
+                           const Topology& topology,
+                           const std::vector<std::size_t>& link_costs)
+    -> std::future<std::size_t>
+{
+    return std::async(std::launch::async,
+                      [&partitions, &topology, &link_costs]() -> std::size_t {
+                          //partitions holding every edge
+                          std::unordered_map<int64_t, std::vector<std::size_t>> spanned;
+                          for(auto&& part : partitions) {
+                              for(auto&& edge : part.getEdges()) {
+                                  spanned[edge].push_back(part.getId());
+                              }
+                          }
+
+                          //partitions per part of every level, 32 per machine and 16 per socket for 8x2x16
+                          std::vector<std::size_t> partitions_per_part(topology.levels.size(), 1);
+                          for(std::size_t level{topology.levels.size() - 1}; level > 0; --level) {
+                              partitions_per_part[level - 1] = partitions_per_part[level] * topology.levels[level];
+                          }
+
+                          std::size_t cost{0};
+                          std::vector<std::size_t> parts;
+                          for(auto&& [edge, ids] : spanned) {
+                              //an edge spanning a parts on one level and b on the level below
+                              //needs b - a links on the level below
+                              std::size_t parts_above{1};
+                              for(std::size_t level{0}; level < topology.levels.size(); ++level) {
+                                  parts.clear();
+                                  for(auto&& id : ids) {
+                                      parts.push_back(id / partitions_per_part[level]);
+                                  }
+                                  std::sort(std::begin(parts), std::end(parts));
+                                  const std::size_t spanned_parts =
+                                      std::distance(std::begin(parts), std::unique(std::begin(parts), std::end(parts)));
+
+                                  cost += link_costs[level] * (spanned_parts - parts_above);
+                                  parts_above = spanned_parts;
+                              }
+                          }
+
+                          return cost;
+                      });
+}